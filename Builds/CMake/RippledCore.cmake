@@ -447,6 +447,7 @@ else ()
     src/ripple/app/misc/HashRouter.cpp
     src/ripple/app/misc/NetworkOPs.cpp
     src/ripple/app/misc/SHAMapStoreImp.cpp
+    src/ripple/app/misc/impl/AccountSubscriptions.cpp
     src/ripple/app/misc/impl/AccountTxPaging.cpp
     src/ripple/app/misc/impl/AmendmentTable.cpp
     src/ripple/app/misc/impl/LoadFeeTrack.cpp
@@ -723,8 +724,10 @@ else ()
          subdir: app
     #]===============================]
     src/test/app/AccountDelete_test.cpp
+    src/test/app/AccountSubscriptions_test.cpp
     src/test/app/AccountTxPaging_test.cpp
     src/test/app/AmendmentTable_test.cpp
+    src/test/app/CanonicalTXSet_test.cpp
     src/test/app/Check_test.cpp
     src/test/app/CrossingLimits_test.cpp
     src/test/app/DeliverMin_test.cpp
@@ -756,6 +759,7 @@ else ()
     src/test/app/SetTrust_test.cpp
     src/test/app/Taker_test.cpp
     src/test/app/Ticket_test.cpp
+    src/test/app/TransactionMaster_test.cpp
     src/test/app/Transaction_ordering_test.cpp
     src/test/app/TrustAndBalance_test.cpp
     src/test/app/TxQ_test.cpp
@@ -849,6 +853,7 @@ else ()
     #]===============================]
     src/test/json/Object_test.cpp
     src/test/json/Output_test.cpp
+    src/test/json/Reader_test.cpp
     src/test/json/Writer_test.cpp
     src/test/json/json_value_test.cpp
     #[===============================[
@@ -1004,6 +1009,7 @@ else ()
          subdir: shamap
     #]===============================]
     src/test/shamap/FetchPack_test.cpp
+    src/test/shamap/FullBelowCache_test.cpp
     src/test/shamap/SHAMapSync_test.cpp
     src/test/shamap/SHAMap_test.cpp
     #[===============================[
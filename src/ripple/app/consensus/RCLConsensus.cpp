@@ -366,13 +366,14 @@ RCLConsensus::Adaptor::onForceAccept(
     ConsensusMode const& mode,
     Json::Value && consensusJson)
 {
-    doAccept(
+    auto const built = doAccept(
         result,
         prevLedger,
         closeResolution,
         rawCloseTimes,
-        mode,
-        std::move(consensusJson));
+        mode);
+    ledgerMaster_.consensusBuilt(
+        built.ledger_, result.txns.id(), std::move(consensusJson));
 }
 
 void
@@ -393,25 +394,29 @@ RCLConsensus::Adaptor::onAccept(
             // is accepted, the consensus results and capture by reference state
             // will not change until startRound is called (which happens via
             // endConsensus).
-            this->doAccept(
+            auto const built = this->doAccept(
                 result,
                 prevLedger,
                 closeResolution,
                 rawCloseTimes,
-                mode,
-                std::move(cj));
+                mode);
+
+            // The open ledger for the next round already exists, so start
+            // that round before the built ledger is checked against the
+            // validations we hold, which may publish it.
             this->app_.getOPs().endConsensus();
+            this->ledgerMaster_.consensusBuilt(
+                built.ledger_, result.txns.id(), std::move(cj));
         });
 }
 
-void
+RCLCxLedger
 RCLConsensus::Adaptor::doAccept(
     Result const& result,
     RCLCxLedger const& prevLedger,
     NetClock::duration closeResolution,
     ConsensusCloseTimes const& rawCloseTimes,
-    ConsensusMode const& mode,
-    Json::Value && consensusJson)
+    ConsensusMode const& mode)
 {
     prevProposers_ = result.proposers;
     prevRoundTime_ = result.roundTime.read();
@@ -534,10 +539,6 @@ RCLConsensus::Adaptor::doAccept(
     else
         JLOG(j_.info()) << "CNF buildLCL " << newLCLHash;
 
-    // See if we can accept a ledger as fully-validated
-    ledgerMaster_.consensusBuilt(
-        built.ledger_, result.txns.id(), std::move(consensusJson));
-
     //-------------------------------------------------------------------------
     {
         // Apply disputed transactions that didn't get in
@@ -662,6 +663,8 @@ RCLConsensus::Adaptor::doAccept(
 
         app_.timeKeeper().adjustCloseTime(offset);
     }
+
+    return built;
 }
 
 void
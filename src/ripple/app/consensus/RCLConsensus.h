@@ -347,16 +347,21 @@ class RCLConsensus
 
         /** Accept a new ledger based on the given transactions.
 
+            Builds the new last closed ledger and the open ledger that
+            follows it. Handing the built ledger to the LedgerMaster for
+            validation tracking is left to the caller, so that it can happen
+            after the next round has started.
+
             @ref onAccept
+            @return The newly built last closed ledger
          */
-        void
+        RCLCxLedger
         doAccept(
             Result const& result,
             RCLCxLedger const& prevLedger,
             NetClock::duration closeResolution,
             ConsensusCloseTimes const& rawCloseTimes,
-            ConsensusMode const& mode,
-            Json::Value&& consensusJson);
+            ConsensusMode const& mode);
 
         /** Build the new last closed ledger.
 
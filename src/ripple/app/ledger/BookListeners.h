@@ -52,13 +52,15 @@ public:
         Uses havePublished to prevent sending duplicate transactions to clients
         that have subscribed to multiple books.
 
-        @param jvObj JSON transaction data to publish
+        @param event JSON transaction data to publish
         @param havePublished InfoSub sequence numbers that have already
                              published this transaction.
 
     */
     void
-    publish(Json::Value const& jvObj, hash_set<std::uint64_t>& havePublished);
+    publish(
+        InfoSub::EventPtr const& event,
+        hash_set<std::uint64_t>& havePublished);
 
 private:
     std::recursive_mutex mLock;
@@ -32,6 +32,7 @@ class Application;
 class CanonicalTXSet;
 class Ledger;
 class LedgerReplay;
+class Rules;
 class SHAMap;
 
 
@@ -62,6 +63,26 @@ buildLedger(
     std::set<TxID>& failedTxs,
     beast::Journal j);
 
+/** Check the signatures of a set of consensus transactions in parallel
+
+    Applying a transaction checks its signature through the HashRouter,
+    which remembers the verdict. Doing those checks first, spread over the
+    job queue, leaves the serial passes that apply the set with cached
+    answers; the order and outcome of applying are unchanged. Replayed
+    ledgers are rebuilt several at a time and skip this step.
+
+    @param app Handle to application instance
+    @param rules The rules of the ledger being built
+    @param txns The transactions to check
+    @param jobs Number of jobs to post; the caller checks signatures too
+ */
+void
+checkSignatures(
+    Application& app,
+    Rules const& rules,
+    CanonicalTXSet const& txns,
+    std::size_t jobs);
+
 /** Build a new ledger by replaying transactions
 
     Build a new ledger by replaying transactions accepted into a prior ledger.
@@ -79,5 +100,27 @@ buildLedger(
     Application& app,
     beast::Journal j);
 
+/** Replay and verify a range of stored ledgers
+
+    Rebuild every ledger in the range from its stored parent and compare
+    the result with the stored ledger. One thread loads each ledger and
+    its transactions while up to `threads` others rebuild the ledgers
+    already loaded.
+
+    @param first The first ledger sequence to replay
+    @param last The last ledger sequence to replay
+    @param app Handle to application instance
+    @param threads Number of threads rebuilding ledgers
+    @param j Journal to use for logging
+    @return The number of ledgers that could not be loaded or did not match
+ */
+std::size_t
+replayLedgers(
+    std::uint32_t first,
+    std::uint32_t last,
+    Application& app,
+    std::size_t threads,
+    beast::Journal j);
+
 }  // namespace ripple
 #endif
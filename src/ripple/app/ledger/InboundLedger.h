@@ -157,12 +157,29 @@ private:
     neededStateHashes (
         int max, SHAMapSyncFilter* filter) const;
 
+    // Returns the parent ledger if the state map can be rebuilt from it
+    std::shared_ptr<Ledger const>
+    getReplayParent ();
+
+    // Queues a job to rebuild the state map from the parent ledger, if
+    // we hold it. Called with the lock held.
+    void
+    startReplay ();
+
+    // Rebuilds the state map by applying the acquired transactions to
+    // the parent ledger, completing the acquisition if the result
+    // matches the header.
+    void
+    replay (std::shared_ptr<Ledger const> const& parent);
+
     std::shared_ptr<Ledger> mLedger;
     bool mHaveHeader;
     bool mHaveState;
     bool mHaveTransactions;
     bool mSignaled;
     bool mByHash;
+    bool mReplayFailed;
+    bool mReplaying;
     std::uint32_t mSeq;
     Reason const mReason;
 
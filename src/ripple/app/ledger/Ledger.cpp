@@ -798,9 +798,6 @@ static bool saveValidatedLedger (
         "DELETE FROM Transactions WHERE LedgerSeq = %u;");
     static boost::format deleteTrans2 (
         "DELETE FROM AccountTransactions WHERE LedgerSeq = %u;");
-    static boost::format deleteAcctTrans (
-        "DELETE FROM AccountTransactions WHERE TransID = '%s';");
-
     if (! ledger->info().accountHash.isNonZero ())
     {
         JLOG (j.fatal()) << "AH is zero: "
@@ -863,6 +860,40 @@ static bool saveValidatedLedger (
 
         std::string const ledgerSeq (std::to_string (seq));
 
+        // Rows are written with a few multi-row statements per batch of
+        // transactions, rather than three statements per transaction,
+        // so SQLite parses and plans far fewer statements per ledger.
+        std::size_t const batchSize = 256;
+
+        std::string deleteSql;
+        std::string acctSql;
+        std::string txnSql;
+        std::size_t batched = 0;
+
+        auto const flush = [&]
+        {
+            if (batched == 0)
+                return;
+
+            deleteSql += ");";
+            *db << deleteSql;
+
+            if (! acctSql.empty ())
+            {
+                acctSql += ";";
+                JLOG (j.trace()) << "ActTx: " << acctSql;
+                *db << acctSql;
+            }
+
+            txnSql += ";";
+            *db << txnSql;
+
+            deleteSql.clear ();
+            acctSql.clear ();
+            txnSql.clear ();
+            batched = 0;
+        };
+
         for (auto const& [_, acceptedLedgerTx] : aLedger->getMap ())
         {
             (void)_;
@@ -874,44 +905,51 @@ static bool saveValidatedLedger (
             std::string const txnId (to_string (transactionID));
             std::string const txnSeq (std::to_string (acceptedLedgerTx->getTxnSeq ()));
 
-            *db << boost::str (deleteAcctTrans % transactionID);
+            if (batched == 0)
+            {
+                deleteSql =
+                    "DELETE FROM AccountTransactions WHERE TransID IN (";
+                txnSql = STTx::getMetaSQLInsertReplaceHeader ();
+            }
+            else
+            {
+                deleteSql += ",";
+                txnSql += ",";
+            }
+
+            deleteSql += "'";
+            deleteSql += txnId;
+            deleteSql += "'";
 
             auto const& accts = acceptedLedgerTx->getAffected ();
 
             if (!accts.empty ())
             {
-                std::string sql (
-                    "INSERT INTO AccountTransactions "
-                    "(TransID, Account, LedgerSeq, TxnSeq) VALUES ");
-
                 // Try to make an educated guess on how much space we'll need
                 // for our arguments. In argument order we have:
                 // 64 + 34 + 10 + 10 = 118 + 10 extra = 128 bytes
-                sql.reserve (sql.length () + (accts.size () * 128));
+                acctSql.reserve (acctSql.length () + (accts.size () * 128));
 
-                bool first = true;
                 for (auto const& account : accts)
                 {
-                    if (!first)
-                        sql += ", ('";
-                    else
+                    if (acctSql.empty ())
                     {
-                        sql += "('";
-                        first = false;
+                        acctSql =
+                            "INSERT INTO AccountTransactions "
+                            "(TransID, Account, LedgerSeq, TxnSeq) VALUES ('";
                     }
-
-                    sql += txnId;
-                    sql += "','";
-                    sql += app.accountIDCache().toBase58(account);
-                    sql += "',";
-                    sql += ledgerSeq;
-                    sql += ",";
-                    sql += txnSeq;
-                    sql += ")";
+                    else
+                        acctSql += ", ('";
+
+                    acctSql += txnId;
+                    acctSql += "','";
+                    acctSql += app.accountIDCache().toBase58(account);
+                    acctSql += "',";
+                    acctSql += ledgerSeq;
+                    acctSql += ",";
+                    acctSql += txnSeq;
+                    acctSql += ")";
                 }
-                sql += ";";
-                JLOG (j.trace()) << "ActTx: " << sql;
-                *db << sql;
             }
             else
             {
@@ -922,12 +960,15 @@ static bool saveValidatedLedger (
                     << acceptedLedgerTx->getTxn()->getJson(JsonOptions::none);
             }
 
-            *db <<
-               (STTx::getMetaSQLInsertReplaceHeader () +
-                acceptedLedgerTx->getTxn ()->getMetaSQL (
-                    seq, acceptedLedgerTx->getEscMeta ()) + ";");
+            txnSql += acceptedLedgerTx->getTxn ()->getMetaSQL (
+                seq, acceptedLedgerTx->getEscMeta ());
+
+            if (++batched == batchSize)
+                flush ();
         }
 
+        flush ();
+
         tr.commit ();
     }
 
@@ -29,14 +29,17 @@
 
 namespace ripple {
 
+class TransactionMaster;
+
 struct LedgerFill
 {
     LedgerFill (ReadView const& l, int o = 0, std::vector<TxQ::TxDetails> q = {},
-                LedgerEntryType t = ltINVALID)
+                LedgerEntryType t = ltINVALID, TransactionMaster* m = nullptr)
         : ledger (l)
         , options (o)
         , txQueue(std::move(q))
         , type (t)
+        , txMaster (m)
     {
     }
 
@@ -54,6 +57,9 @@ struct LedgerFill
     int options;
     std::vector<TxQ::TxDetails> txQueue;
     LedgerEntryType type;
+
+    // When set, expanded transactions are rendered through its cache.
+    TransactionMaster* txMaster;
 };
 
 /** Given a Ledger and options, fill a Json::Object or Json::Value with a
@@ -61,6 +67,7 @@ struct LedgerFill
  */
 
 void addJson(Json::Value&, LedgerFill const&);
+void addJson(Json::Object&, LedgerFill const&);
 
 /** Return a new Json::Value representing the ledger with given options.*/
 Json::Value getJson (LedgerFill const&);
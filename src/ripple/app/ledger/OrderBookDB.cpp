@@ -240,7 +240,7 @@ BookListeners::pointer OrderBookDB::getBookListeners (Book const& book)
 // We need to determine which streams a given meta effects.
 void OrderBookDB::processTxn (
     std::shared_ptr<ReadView const> const& ledger,
-        const AcceptedLedgerTx& alTx, Json::Value const& jvObj)
+        const AcceptedLedgerTx& alTx, InfoSub::EventPtr const& event)
 {
     std::lock_guard sl (mLock);
     if (alTx.getResult () == tesSUCCESS)
@@ -288,7 +288,7 @@ void OrderBookDB::processTxn (
                             auto listeners = getBookListeners(b);
                             if (listeners)
                             {
-                                listeners->publish(jvObj, havePublished);
+                                listeners->publish(event, havePublished);
                             }
                         }
                     }
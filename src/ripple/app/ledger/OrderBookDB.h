@@ -56,7 +56,7 @@ public:
     // see if this txn effects any orderbook
     void processTxn (
         std::shared_ptr<ReadView const> const& ledger,
-        const AcceptedLedgerTx& alTx, Json::Value const& jvObj);
+        const AcceptedLedgerTx& alTx, InfoSub::EventPtr const& event);
 
     using IssueToOrderBook = hash_map <Issue, OrderBook::List>;
 
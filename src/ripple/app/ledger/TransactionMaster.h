@@ -20,6 +20,8 @@
 #ifndef RIPPLE_APP_LEDGER_TRANSACTIONMASTER_H_INCLUDED
 #define RIPPLE_APP_LEDGER_TRANSACTIONMASTER_H_INCLUDED
 
+#include <ripple/basics/TaggedCache.h>
+#include <ripple/json/json_value.h>
 #include <ripple/shamap/SHAMapItem.h>
 #include <ripple/shamap/SHAMapTreeNode.h>
 
@@ -51,6 +53,15 @@ public:
 
     void canonicalize (std::shared_ptr<Transaction>* pTransaction);
 
+    /** Return the JSON form of a transaction.
+
+        A transaction's ID covers every field, so its rendering never
+        changes. Recently rendered transactions are kept and copied
+        instead of being rendered again for each request or stream.
+    */
+    Json::Value
+    getJson (STTx const& txn);
+
     void sweep (void);
 
     TaggedCache <uint256, Transaction>&
@@ -59,6 +70,7 @@ public:
 private:
     Application& mApp;
     TaggedCache <uint256, Transaction> mCache;
+    TaggedCache <uint256, Json::Value const> mJsonCache;
 };
 
 } // ripple
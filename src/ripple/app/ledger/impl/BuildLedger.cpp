@@ -19,12 +19,21 @@
 
 #include <ripple/app/ledger/BuildLedger.h>
 #include <ripple/app/ledger/Ledger.h>
+#include <ripple/app/ledger/LedgerMaster.h>
 #include <ripple/app/ledger/LedgerReplay.h>
 #include <ripple/app/ledger/OpenLedger.h>
 #include <ripple/app/main/Application.h>
 #include <ripple/app/misc/CanonicalTXSet.h>
+#include <ripple/app/misc/HashRouter.h>
 #include <ripple/app/tx/apply.h>
+#include <ripple/basics/contract.h>
+#include <ripple/core/JobQueue.h>
 #include <ripple/protocol/Feature.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 
 namespace ripple {
 
@@ -78,6 +87,81 @@ buildLedgerImpl(
     return built;
 }
 
+void
+checkSignatures(
+    Application& app,
+    Rules const& rules,
+    CanonicalTXSet const& txns,
+    std::size_t jobs)
+{
+    // Shared with the jobs, which may start after this returns
+    struct State
+    {
+        Rules rules;
+        std::vector<std::shared_ptr<STTx const>> pending;
+        std::atomic<std::size_t> next{0};
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::size_t active = 0;
+        bool finished = false;
+
+        explicit State(Rules const& r) : rules(r) {}
+    };
+    auto state = std::make_shared<State>(rules);
+    state->pending.reserve(txns.size());
+    for (auto const& item : txns)
+    {
+        // Pseudo-transactions are not signed
+        if (!isPseudoTx(*item.second))
+            state->pending.push_back(item.second);
+    }
+
+    auto check = [&app](State& st)
+    {
+        for (auto i = st.next++; i < st.pending.size(); i = st.next++)
+        {
+            try
+            {
+                checkValidity(
+                    app.getHashRouter(), *st.pending[i], st.rules,
+                        app.config());
+            }
+            catch (std::exception const&)
+            {
+                // Left for the serial pass to report
+            }
+        }
+    };
+
+    for (std::size_t i = 0; i < jobs; ++i)
+    {
+        app.getJobQueue().addJob(jtACCEPT, "checkSignatures",
+            [state, check](Job&)
+            {
+                {
+                    std::lock_guard lock(state->mutex);
+                    if (state->finished)
+                        return;
+                    ++state->active;
+                }
+                check(*state);
+                {
+                    std::lock_guard lock(state->mutex);
+                    --state->active;
+                }
+                state->cv.notify_all();
+            });
+    }
+
+    // Work alongside the jobs. Once every signature has been claimed,
+    // wait only for the jobs that are still checking one: a job that has
+    // not started yet finds nothing left to do.
+    check(*state);
+    std::unique_lock lock(state->mutex);
+    state->finished = true;
+    state->cv.wait(lock, [&] { return state->active == 0; });
+}
+
 /** Apply a set of consensus transactions to a ledger.
 
   @param app Handle to application
@@ -100,6 +184,16 @@ applyTransactions(
     bool certainRetry = true;
     std::size_t count = 0;
 
+    {
+        // Checking this many signatures costs more than posting a job
+        std::size_t constexpr minPerJob = 64;
+
+        auto const jobs = std::min<std::size_t>(
+            std::thread::hardware_concurrency(), txns.size() / minPerJob);
+        if (jobs > 1)
+            checkSignatures(app, view.rules(), txns, jobs - 1);
+    }
+
     // Attempt to apply all of the retriable transactions
     for (int pass = 0; pass < LEDGER_TOTAL_PASSES; ++pass)
     {
@@ -234,4 +328,149 @@ buildLedger(
         });
 }
 
+std::size_t
+replayLedgers(
+    std::uint32_t first,
+    std::uint32_t last,
+    Application& app,
+    std::size_t threads,
+    beast::Journal j)
+{
+    assert(first > 1 && first <= last && threads > 0);
+
+    auto const start = std::chrono::steady_clock::now();
+    auto& ledgerMaster = app.getLedgerMaster();
+
+    // Loaded ledgers waiting to be rebuilt, bounded so that
+    // loading does not run too far ahead of rebuilding.
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::unique_ptr<LedgerReplay>> ready;
+    bool loaded = false;
+    std::atomic<std::size_t> failed{0};
+
+    auto rebuild = [&]()
+    {
+        for (;;)
+        {
+            std::unique_ptr<LedgerReplay> replay;
+            {
+                std::unique_lock lock(mutex);
+                cv.wait(lock, [&] { return loaded || !ready.empty(); });
+                if (ready.empty())
+                    return;
+                replay = std::move(ready.front());
+                ready.pop_front();
+            }
+            cv.notify_all();
+
+            auto const& info = replay->replay()->info();
+            try
+            {
+                auto const built = buildLedger(*replay, tapNONE, app, j);
+                if (built->info().hash == info.hash)
+                    continue;
+                JLOG(j.error()) << "Replay of ledger " << info.seq
+                                << " built " << built->info().hash
+                                << " instead of " << info.hash;
+            }
+            catch (std::exception const& e)
+            {
+                JLOG(j.error()) << "Replay of ledger " << info.seq
+                                << " throws: " << e.what();
+            }
+            ++failed;
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+
+    // Let the workers drain what was loaded, then join them. This must
+    // also happen if loading throws: destroying a joinable thread would
+    // terminate the process.
+    auto finish = [&]()
+    {
+        {
+            std::lock_guard lock(mutex);
+            loaded = true;
+        }
+        cv.notify_all();
+        for (auto& worker : workers)
+            worker.join();
+    };
+
+    try
+    {
+        for (std::size_t i = 0; i < threads; ++i)
+            workers.emplace_back(rebuild);
+
+        // Each ledger is replayed on its stored parent, so later ledgers
+        // load while earlier ones are still being rebuilt.
+        std::shared_ptr<Ledger const> parent;
+        try
+        {
+            parent = ledgerMaster.getLedgerBySeq(first - 1);
+        }
+        catch (std::exception const& e)
+        {
+            JLOG(j.error()) << "Loading ledger " << first - 1
+                            << " throws: " << e.what();
+        }
+
+        for (auto seq = first; seq <= last; ++seq)
+        {
+            std::shared_ptr<Ledger const> ledger;
+            std::unique_ptr<LedgerReplay> replay;
+            try
+            {
+                ledger = ledgerMaster.getLedgerBySeq(seq);
+                if (ledger && parent &&
+                    ledger->info().parentHash == parent->info().hash)
+                {
+                    replay = std::make_unique<LedgerReplay>(parent, ledger);
+                }
+                else
+                {
+                    JLOG(j.error()) << "Ledger " << seq << " or its parent "
+                                    << "is not stored";
+                }
+            }
+            catch (std::exception const& e)
+            {
+                JLOG(j.error()) << "Loading ledger " << seq
+                                << " throws: " << e.what();
+            }
+            parent = std::move(ledger);
+
+            if (!replay)
+            {
+                ++failed;
+                continue;
+            }
+
+            {
+                std::unique_lock lock(mutex);
+                cv.wait(lock, [&] { return ready.size() < 2 * threads; });
+                ready.push_back(std::move(replay));
+            }
+            cv.notify_all();
+        }
+    }
+    catch (...)
+    {
+        finish();
+        Rethrow();
+    }
+    finish();
+
+    using namespace std::chrono;
+    auto const elapsed = duration_cast<milliseconds>(
+        steady_clock::now() - start);
+    JLOG(j.info()) << "Replayed ledgers " << first << "-" << last << " in "
+                   << elapsed.count() << " ms using " << threads
+                   << " threads, " << failed << " failed";
+    return failed;
+}
+
 }  // namespace ripple
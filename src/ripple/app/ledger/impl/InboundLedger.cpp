@@ -20,8 +20,10 @@
 #include <ripple/app/ledger/InboundLedger.h>
 #include <ripple/shamap/SHAMapNodeID.h>
 #include <ripple/app/ledger/AccountStateSF.h>
+#include <ripple/app/ledger/BuildLedger.h>
 #include <ripple/app/ledger/InboundLedgers.h>
 #include <ripple/app/ledger/LedgerMaster.h>
+#include <ripple/app/ledger/LedgerReplay.h>
 #include <ripple/app/ledger/TransactionStateSF.h>
 #include <ripple/app/main/Application.h>
 #include <ripple/app/misc/NetworkOPs.h>
@@ -75,6 +77,8 @@ InboundLedger::InboundLedger(Application& app, uint256 const& hash,
     , mHaveTransactions (false)
     , mSignaled (false)
     , mByHash (true)
+    , mReplayFailed (false)
+    , mReplaying (false)
     , mSeq (seq)
     , mReason (reason)
     , mReceiveDispatched (false)
@@ -639,8 +643,14 @@ void InboundLedger::trigger (std::shared_ptr<Peer> const& peer, TriggerReason re
     else
         tmGL.set_querydepth (1);
 
+    // If we hold the parent ledger, the transactions are enough to
+    // rebuild the state map locally.
+    if (mHaveHeader && mHaveTransactions && !mHaveState && !mFailed)
+        startReplay ();
+
     // Get the state data first because it's the most likely to be useful
-    // if we wind up abandoning this fetch.
+    // if we wind up abandoning this fetch. Keep fetching while a replay
+    // runs, in case the replay is slow or does not match.
     if (mHaveHeader && !mHaveState && !mFailed)
     {
         assert (mLedger);
@@ -781,6 +791,9 @@ void InboundLedger::trigger (std::shared_ptr<Peer> const& peer, TriggerReason re
         }
     }
 
+    if (mHaveHeader && mHaveTransactions && !mHaveState && !mFailed)
+        startReplay ();
+
     if (mComplete || mFailed)
     {
         JLOG (m_journal.debug()) <<
@@ -792,6 +805,94 @@ void InboundLedger::trigger (std::shared_ptr<Peer> const& peer, TriggerReason re
     }
 }
 
+std::shared_ptr<Ledger const>
+InboundLedger::getReplayParent ()
+{
+    // Replayed ledgers are written to the node store, not the shard store
+    if (mReplayFailed || mReason == Reason::SHARD || !mLedger)
+        return {};
+
+    auto const& info = mLedger->info();
+    if (info.seq < 2 || !app_.getLedgerMaster().haveLedger (info.seq - 1))
+        return {};
+
+    auto parent = app_.getLedgerMaster().getLedgerByHash (info.parentHash);
+    if (!parent || parent->info().seq + 1 != info.seq)
+        return {};
+    return parent;
+}
+
+void
+InboundLedger::startReplay ()
+{
+    if (mReplaying)
+        return;
+
+    auto parent = getReplayParent ();
+    if (!parent)
+        return;
+
+    // The replay can take a while, so it runs as its own job without
+    // holding our lock.
+    mReplaying = app_.getJobQueue ().addJob (
+        jtLEDGER_DATA, "InboundLedger::replay",
+        [self = shared_from_this(), parent = std::move (parent)] (Job&)
+        {
+            self->replay (parent);
+        });
+}
+
+void
+InboundLedger::replay (std::shared_ptr<Ledger const> const& parent)
+{
+    std::shared_ptr<Ledger const> ledger;
+    {
+        ScopedLockType sl (mLock);
+        if (isDone () || mHaveState)
+        {
+            mReplaying = false;
+            return;
+        }
+        ledger = mLedger;
+    }
+
+    std::shared_ptr<Ledger> built;
+    try
+    {
+        built = buildLedger (LedgerReplay (parent, ledger),
+            tapNONE, app_, m_journal);
+    }
+    catch (std::exception const& e)
+    {
+        JLOG (m_journal.warn()) <<
+            "Replay of " << mHash << " throws: " << e.what();
+    }
+
+    ScopedLockType sl (mLock);
+    mReplaying = false;
+
+    if (isDone () || mHaveState || ledger != mLedger)
+        return;
+
+    if (!built || built->info().hash != mHash)
+    {
+        JLOG (m_journal.debug()) <<
+            "Replay of " << mHash << " does not match, fetching state";
+        mReplayFailed = true;
+        return;
+    }
+
+    JLOG (m_journal.debug()) <<
+        "Rebuilt state of " << mHash << " from its parent";
+    mLedger = std::move (built);
+    mHaveState = true;
+    mComplete = true;
+    progress ();
+
+    sl.unlock ();
+    done ();
+}
+
 void InboundLedger::filterNodes (
     std::vector<std::pair<SHAMapNodeID, uint256>>& nodes,
     TriggerReason reason)
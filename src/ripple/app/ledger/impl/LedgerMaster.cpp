@@ -987,8 +987,10 @@ LedgerMaster::consensusBuilt(
     Json::Value consensus)
 {
 
-    // Because we just built a ledger, we are no longer building one
-    setBuildingLedger (0);
+    // Because we just built a ledger, we are no longer building it. The next
+    // round may already be building its successor, so leave that alone.
+    auto building = ledger->info().seq;
+    mBuildingLedgerSeq.compare_exchange_strong (building, 0);
 
     // No need to process validations in standalone mode
     if (standalone_)
@@ -18,6 +18,7 @@
 //==============================================================================
 
 #include <ripple/app/ledger/LedgerToJson.h>
+#include <ripple/app/ledger/TransactionMaster.h>
 #include <ripple/app/misc/TxQ.h>
 #include <ripple/basics/base_uint.h>
 #include <ripple/basics/date.h>
@@ -120,7 +121,10 @@ fillJsonTx(
     }
     else
     {
-        copyFrom(txJson, txn->getJson(JsonOptions::none));
+        if (fill.txMaster)
+            txJson = fill.txMaster->getJson(*txn);
+        else
+            copyFrom(txJson, txn->getJson(JsonOptions::none));
         if (stMeta)
         {
             txJson[jss::metaData] = stMeta->getJson(JsonOptions::none);
@@ -268,6 +272,17 @@ void addJson (Json::Value& json, LedgerFill const& fill)
         fillJsonQueue(json, fill);
 }
 
+void addJson (Json::Object& json, LedgerFill const& fill)
+{
+    {
+        auto&& object = Json::addObject (json, jss::ledger);
+        fillJson (object, fill);
+    }
+
+    if ((fill.options & LedgerFill::dumpQueue) && !fill.txQueue.empty())
+        fillJsonQueue(json, fill);
+}
+
 Json::Value getJson (LedgerFill const& fill)
 {
     Json::Value json;
@@ -30,6 +30,8 @@ TransactionMaster::TransactionMaster (Application& app)
     : mApp (app)
     , mCache ("TransactionCache", 65536, std::chrono::minutes {30}, stopwatch(),
         mApp.journal("TaggedCache"))
+    , mJsonCache ("TransactionJsonCache", 8192, std::chrono::minutes {5},
+        stopwatch(), mApp.journal("TaggedCache"))
 {
 }
 
@@ -108,9 +110,24 @@ TransactionMaster::canonicalize(std::shared_ptr<Transaction>* pTransaction)
     }
 }
 
+Json::Value
+TransactionMaster::getJson (STTx const& txn)
+{
+    uint256 const tid = txn.getTransactionID ();
+
+    if (auto const json = mJsonCache.fetch (tid))
+        return *json;
+
+    auto json = std::make_shared<Json::Value const> (
+        txn.getJson (JsonOptions::none));
+    mJsonCache.canonicalize (tid, json);
+    return *json;
+}
+
 void TransactionMaster::sweep (void)
 {
     mCache.sweep ();
+    mJsonCache.sweep ();
 }
 
 TaggedCache <uint256, Transaction>& TransactionMaster::getCache()
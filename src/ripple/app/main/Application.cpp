@@ -24,6 +24,7 @@
 #include <ripple/app/main/DBInit.h>
 #include <ripple/app/main/BasicApp.h>
 #include <ripple/app/main/Tuning.h>
+#include <ripple/app/ledger/BuildLedger.h>
 #include <ripple/app/ledger/InboundLedgers.h>
 #include <ripple/app/ledger/LedgerMaster.h>
 #include <ripple/app/ledger/LedgerToJson.h>
@@ -74,6 +75,7 @@
 #include <iostream>
 #include <mutex>
 #include <sstream>
+#include <thread>
 
 namespace ripple {
 
@@ -238,6 +240,37 @@ public:
         fullbelow_.reset();
         treecache_.reset();
     }
+
+    // Keeps the full below cache across a clean restart. The keys are
+    // tied to the node store's writable backend, which online delete
+    // replaces on every rotation, so keys from another one are dropped.
+    void
+    saveFullBelow (boost::filesystem::path const& file) const
+    {
+        if (! fullbelow_.save (file, db_.getName()))
+        {
+            JLOG (j_.warn()) <<
+                "Unable to save full below cache to " << file;
+            return;
+        }
+        JLOG (j_.info()) <<
+            "Saved " << fullbelow_.size() << " full below cache entries";
+    }
+
+    void
+    loadFullBelow (boost::filesystem::path const& file)
+    {
+        auto const loaded = fullbelow_.load (file, db_.getName(),
+            [this](uint256 const& key)
+            {
+                return static_cast<bool>(db_.fetch (key, 0));
+            }, j_);
+        if (loaded)
+        {
+            JLOG (j_.info()) <<
+                "Loaded " << loaded << " full below cache entries";
+        }
+    }
 };
 
 } // detail
@@ -928,6 +961,14 @@ public:
         return true;
     }
 
+    // Location of the full below cache saved across restarts
+    boost::filesystem::path
+    fullBelowFile() const
+    {
+        return boost::filesystem::path (
+            config_->legacy ("database_path")) / "fullbelow.bin";
+    }
+
     bool
     initNodeStoreDBs()
     {
@@ -1271,6 +1312,7 @@ private:
 
     bool nodeToShards ();
     bool validateShards ();
+    bool replayLedgerRange ();
     void startGenesisLedger ();
 
     std::shared_ptr<Ledger>
@@ -1332,6 +1374,9 @@ bool ApplicationImp::setup()
     if (!initSQLiteDBs() || !initNodeStoreDBs())
         return false;
 
+    if (!config_->standalone())
+        family_.loadFullBelow (fullBelowFile());
+
     if (!peerReservations_->load(getWalletDB()))
     {
         JLOG(m_journal.fatal()) << "Cannot find peer reservations!";
@@ -1476,6 +1521,9 @@ bool ApplicationImp::setup()
             return false;
     }
 
+    if (config_->replayRange && !replayLedgerRange())
+        return false;
+
     validatorSites_->start ();
 
     // start first consensus round
@@ -1612,6 +1660,8 @@ ApplicationImp::run()
     // Stoppable objects should be stopped.
     JLOG(m_journal.info()) << "Received shutdown request";
     stop (m_journal);
+    if (!config_->standalone())
+        family_.saveFullBelow (fullBelowFile());
     JLOG(m_journal.info()) << "Done.";
     StopSustain();
 }
@@ -2131,6 +2181,23 @@ bool ApplicationImp::validateShards()
     return true;
 }
 
+bool ApplicationImp::replayLedgerRange()
+{
+    auto const [first, last] = *config_->replayRange;
+    auto const threads = std::max (1u, std::thread::hardware_concurrency());
+
+    JLOG (m_journal.info()) <<
+        "Replaying ledgers " << first << "-" << last;
+    if (replayLedgers (first, last, *this, threads,
+        logs_->journal ("LedgerReplay")) != 0)
+    {
+        JLOG (m_journal.fatal()) <<
+            "Ledgers " << first << "-" << last << " failed to replay";
+        return false;
+    }
+    return true;
+}
+
 void ApplicationImp::setMaxDisallowedLedger()
 {
     boost::optional <LedgerIndex> seq;
@@ -36,6 +36,7 @@
 #include <ripple/protocol/BuildInfo.h>
 #include <ripple/beast/clock/basic_seconds_clock.h>
 #include <ripple/beast/core/CurrentThreadName.h>
+#include <ripple/beast/core/LexicalCast.h>
 
 #include <beast/unit_test/dstream.hpp>
 #include <beast/unit_test/global_suites.hpp>
@@ -338,6 +339,8 @@ int run (int argc, char** argv)
     ("net", "Get the initial ledger from the network.")
     ("nodetoshard", "Import node store into shards")
     ("replay","Replay a ledger close.")
+    ("replay_range", po::value<std::string> (),
+        "Replay and verify the stored ledgers in the range 'first-last'.")
     ("start", "Start from a fresh Ledger.")
     ("vacuum", po::value<std::string>(),
         "VACUUM the transaction db. Mandatory string argument specifies "
@@ -554,6 +557,23 @@ int run (int argc, char** argv)
     if (vm.count ("validateShards"))
         config->validateShards = true;
 
+    if (vm.count ("replay_range"))
+    {
+        auto const range = vm["replay_range"].as<std::string> ();
+        auto const dash = range.find ('-');
+        std::uint32_t first, last;
+        if (dash == std::string::npos ||
+            ! beast::lexicalCastChecked (first, range.substr (0, dash)) ||
+            ! beast::lexicalCastChecked (last, range.substr (dash + 1)) ||
+            first < 2 || first > last)
+        {
+            std::cerr << "Invalid value specified for --replay_range ("
+                      << range << ")\n";
+            return -1;
+        }
+        config->replayRange = std::make_pair (first, last);
+    }
+
     if (vm.count ("ledger"))
     {
         config->START_LEDGER = vm["ledger"].as<std::string> ();
@@ -18,103 +18,94 @@
 //==============================================================================
 
 #include <ripple/app/misc/CanonicalTXSet.h>
-#include <boost/range/adaptor/transformed.hpp>
+#include <algorithm>
+#include <cassert>
 
 namespace ripple {
 
-bool CanonicalTXSet::Key::operator< (Key const& rhs) const
+uint160 CanonicalTXSet::accountKey (AccountID const& account) const
 {
-    if (mAccount < rhs.mAccount) return true;
-
-    if (mAccount > rhs.mAccount) return false;
-
-    if (mSeq < rhs.mSeq) return true;
-
-    if (mSeq > rhs.mSeq) return false;
-
-    return mTXid < rhs.mTXid;
-}
-
-bool CanonicalTXSet::Key::operator> (Key const& rhs) const
-{
-    if (mAccount > rhs.mAccount) return true;
-
-    if (mAccount < rhs.mAccount) return false;
-
-    if (mSeq > rhs.mSeq) return true;
-
-    if (mSeq < rhs.mSeq) return false;
-
-    return mTXid > rhs.mTXid;
-}
-
-bool CanonicalTXSet::Key::operator<= (Key const& rhs) const
-{
-    if (mAccount < rhs.mAccount) return true;
-
-    if (mAccount > rhs.mAccount) return false;
-
-    if (mSeq < rhs.mSeq) return true;
-
-    if (mSeq > rhs.mSeq) return false;
-
-    return mTXid <= rhs.mTXid;
-}
-
-bool CanonicalTXSet::Key::operator>= (Key const& rhs)const
-{
-    if (mAccount > rhs.mAccount) return true;
-
-    if (mAccount < rhs.mAccount) return false;
-
-    if (mSeq > rhs.mSeq) return true;
-
-    if (mSeq < rhs.mSeq) return false;
-
-    return mTXid >= rhs.mTXid;
-}
-
-uint256 CanonicalTXSet::accountKey (AccountID const& account)
-{
-    uint256 ret = beast::zero;
+    // Only the leading bytes of the salt reach the account, the rest would
+    // be the same for every key.
+    uint160 ret;
     memcpy (
         ret.begin (),
         account.begin (),
         account.size ());
-    ret ^= salt_;
+    for (std::size_t i = 0; i < ret.size (); ++i)
+        ret.data ()[i] ^= salt_.data ()[i];
     return ret;
 }
 
+void CanonicalTXSet::normalize () const
+{
+    if (sorted_)
+        return;
+
+    entries_.erase (
+        std::remove_if (entries_.begin (), entries_.end (),
+            [](Entry const& e) { return ! e.second; }),
+        entries_.end ());
+
+    // Entries with equal keys hold the same transaction, so it does not
+    // matter which of them unique keeps.
+    std::sort (entries_.begin (), entries_.end (),
+        [](Entry const& a, Entry const& b) { return a.first < b.first; });
+    entries_.erase (
+        std::unique (entries_.begin (), entries_.end (),
+            [](Entry const& a, Entry const& b) { return a.first == b.first; }),
+        entries_.end ());
+
+    size_ = entries_.size ();
+    sorted_ = true;
+}
+
 void CanonicalTXSet::insert (std::shared_ptr<STTx const> const& txn)
 {
-    map_.insert (
-        std::make_pair (
-            Key (
-                accountKey (txn->getAccountID(sfAccount)),
-                txn->getSequence (),
-                txn->getTransactionID ()),
-            txn));
+    entries_.emplace_back (
+        Key (
+            accountKey (txn->getAccountID(sfAccount)),
+            txn->getSequence (),
+            txn->getTransactionID ()),
+        txn);
+    sorted_ = false;
+}
+
+CanonicalTXSet::const_iterator
+CanonicalTXSet::erase (const_iterator const& it)
+{
+    assert (sorted_ && it.it_ != entries_.cend () && it.it_->second);
+    entries_[it.it_ - entries_.cbegin ()].second.reset ();
+    --size_;
+    return std::next (it);
 }
 
 std::vector<std::shared_ptr<STTx const>>
 CanonicalTXSet::prune(AccountID const& account,
     std::uint32_t const seq)
 {
-    auto effectiveAccount = accountKey (account);
-
-    Key keyLow(effectiveAccount, seq, beast::zero);
-    Key keyHigh(effectiveAccount, seq+1, beast::zero);
-
-    auto range = boost::make_iterator_range(
-        map_.lower_bound(keyLow),
-        map_.lower_bound(keyHigh));
-    auto txRange = boost::adaptors::transform(range,
-        [](auto const& p) { return p.second; });
-
-    std::vector<std::shared_ptr<STTx const>> result(
-        txRange.begin(), txRange.end());
-
-    map_.erase(range.begin(), range.end());
+    normalize ();
+
+    auto const effectiveAccount = accountKey (account);
+
+    auto const byKey = [](Entry const& e, Key const& k)
+    {
+        return e.first < k;
+    };
+    auto const first = std::lower_bound (entries_.begin (), entries_.end (),
+        Key (effectiveAccount, seq, beast::zero), byKey);
+    auto const last = std::lower_bound (first, entries_.end (),
+        Key (effectiveAccount, seq + 1, beast::zero), byKey);
+
+    std::vector<std::shared_ptr<STTx const>> result;
+    for (auto it = first; it != last; ++it)
+    {
+        if (it->second)
+            result.push_back (std::move (it->second));
+    }
+
+    entries_.erase (first, last);
+    size_ -= result.size ();
     return result;
 }
 
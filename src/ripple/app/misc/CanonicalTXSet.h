@@ -22,6 +22,10 @@
 
 #include <ripple/protocol/RippleLedgerHash.h>
 #include <ripple/protocol/STTx.h>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <vector>
 
 namespace ripple {
 
@@ -31,6 +35,11 @@ namespace ripple {
 
     - Puts transactions from the same account in sequence order
 
+    Transactions are kept in a vector which is sorted the first time the set
+    is read after an insert. Erasing leaves a hole that iteration skips, so
+    the retry passes can drop applied transactions without moving the rest.
+    Like the other containers, a set must not be read from several threads
+    without a lock.
 */
 // VFALCO TODO rename to SortedTxSet
 class CanonicalTXSet
@@ -39,17 +48,23 @@ private:
     class Key
     {
     public:
-        Key (uint256 const& account, std::uint32_t seq, uint256 const& id)
+        Key (uint160 const& account, std::uint32_t seq, uint256 const& id)
             : mAccount (account)
             , mTXid (id)
             , mSeq (seq)
         {
         }
 
-        bool operator<  (Key const& rhs) const;
-        bool operator>  (Key const& rhs) const;
-        bool operator<= (Key const& rhs) const;
-        bool operator>= (Key const& rhs) const;
+        bool operator<  (Key const& rhs) const
+        {
+            if (auto const c = std::memcmp (
+                    mAccount.data (), rhs.mAccount.data (), mAccount.size ()))
+                return c < 0;
+            if (mSeq != rhs.mSeq)
+                return mSeq < rhs.mSeq;
+            return std::memcmp (
+                mTXid.data (), rhs.mTXid.data (), mTXid.size ()) < 0;
+        }
 
         bool operator== (Key const& rhs) const
         {
@@ -66,16 +81,87 @@ private:
         }
 
     private:
-        uint256 mAccount;
+        uint160 mAccount;
         uint256 mTXid;
         std::uint32_t mSeq;
     };
 
+    using Entry = std::pair <Key, std::shared_ptr<STTx const>>;
+    using Entries = std::vector <Entry>;
+
     // Calculate the salted key for the given account
-    uint256 accountKey (AccountID const& account);
+    uint160 accountKey (AccountID const& account) const;
+
+    // Sort pending inserts into place, dropping holes and duplicates
+    void normalize () const;
 
 public:
-    using const_iterator = std::map <Key, std::shared_ptr<STTx const>>::const_iterator;
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Entry;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Entry const*;
+        using reference = Entry const&;
+
+        const_iterator () = default;
+
+        reference operator* () const
+        {
+            return *it_;
+        }
+
+        pointer operator-> () const
+        {
+            return &*it_;
+        }
+
+        const_iterator& operator++ ()
+        {
+            ++it_;
+            skip ();
+            return *this;
+        }
+
+        const_iterator operator++ (int)
+        {
+            auto ret = *this;
+            ++(*this);
+            return ret;
+        }
+
+        bool operator== (const_iterator const& rhs) const
+        {
+            return it_ == rhs.it_;
+        }
+
+        bool operator!= (const_iterator const& rhs) const
+        {
+            return it_ != rhs.it_;
+        }
+
+    private:
+        friend class CanonicalTXSet;
+
+        const_iterator (
+            Entries::const_iterator it, Entries::const_iterator end)
+            : it_ (it)
+            , end_ (end)
+        {
+            skip ();
+        }
+
+        // Step over entries which were erased
+        void skip ()
+        {
+            while (it_ != end_ && ! it_->second)
+                ++it_;
+        }
+
+        Entries::const_iterator it_;
+        Entries::const_iterator end_;
+    };
 
 public:
     explicit CanonicalTXSet (LedgerHash const& saltHash)
@@ -92,31 +178,33 @@ public:
     void reset (LedgerHash const& salt)
     {
         salt_ = salt;
-        map_.clear ();
+        entries_.clear ();
+        size_ = 0;
+        sorted_ = true;
     }
 
-    const_iterator erase (const_iterator const& it)
-    {
-        return map_.erase(it);
-    }
+    const_iterator erase (const_iterator const& it);
 
     const_iterator begin () const
     {
-        return map_.begin();
+        normalize ();
+        return const_iterator (entries_.cbegin (), entries_.cend ());
     }
 
     const_iterator end() const
     {
-        return map_.end();
+        normalize ();
+        return const_iterator (entries_.cend (), entries_.cend ());
     }
 
     size_t size () const
     {
-        return map_.size ();
+        normalize ();
+        return size_;
     }
     bool empty () const
     {
-        return map_.empty ();
+        return size () == 0;
     }
 
     uint256 const& key() const
@@ -125,7 +213,16 @@ public:
     }
 
 private:
-    std::map <Key, std::shared_ptr<STTx const>> map_;
+    // Erased entries stay in place with a null transaction until the next
+    // time the set is sorted.
+    mutable Entries entries_;
+
+    // The number of entries which have not been erased; only accurate
+    // while sorted_ is true.
+    mutable std::size_t size_ = 0;
+
+    // Whether entries_ is in canonical order with no duplicates
+    mutable bool sorted_ = true;
 
     // Used to salt the accounts so people can't mine for low account numbers
     uint256 salt_;
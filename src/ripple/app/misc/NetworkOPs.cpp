@@ -37,6 +37,7 @@
 #include <ripple/app/misc/TxQ.h>
 #include <ripple/app/misc/ValidatorKeys.h>
 #include <ripple/app/misc/ValidatorList.h>
+#include <ripple/app/misc/impl/AccountSubscriptions.h>
 #include <ripple/app/misc/impl/AccountTxPaging.h>
 #include <ripple/app/tx/apply.h>
 #include <ripple/basics/base64.h>
@@ -553,7 +554,6 @@ private:
 
 private:
     using SubMapType = hash_map <std::uint64_t, InfoSub::wptr>;
-    using SubInfoMapType = hash_map <AccountID, SubMapType>;
     using subRpcMapType = hash_map<std::string, InfoSub::pointer>;
 
     Application& app_;
@@ -580,8 +580,8 @@ private:
     LedgerMaster& m_ledgerMaster;
     std::shared_ptr<InboundLedger> mAcquiringLedger;
 
-    SubInfoMapType mSubAccount;
-    SubInfoMapType mSubRTAccount;
+    AccountSubscriptions mSubAccount;
+    AccountSubscriptions mSubRTAccount;
 
     subRpcMapType mRpcSubMap;
 
@@ -1613,12 +1613,15 @@ void NetworkOPsImp::pubManifest (Manifest const& mo)
             jvObj [jss::signature] = strHex (*sig);
         jvObj [jss::master_signature] = strHex (mo.getMasterSignature ());
 
+        auto const event = std::make_shared<InfoSub::Event const> (
+            std::move (jvObj));
+
         for (auto i = mStreamMaps[sManifests].begin ();
             i != mStreamMaps[sManifests].end (); )
         {
             if (auto p = i->second.lock())
             {
-                p->send (jvObj, true);
+                p->send (event, true);
                 ++i;
             }
             else
@@ -1712,6 +1715,9 @@ void NetworkOPsImp::pubServer ()
 
         mLastFeeSummary = f;
 
+        auto const event = std::make_shared<InfoSub::Event const> (
+            std::move (jvObj));
+
         for (auto i = mStreamMaps[sServer].begin ();
             i != mStreamMaps[sServer].end (); )
         {
@@ -1722,7 +1728,7 @@ void NetworkOPsImp::pubServer ()
             //             sending of JSON data.
             if (p)
             {
-                p->send (jvObj, true);
+                p->send (event, true);
                 ++i;
             }
             else
@@ -1744,12 +1750,15 @@ void NetworkOPsImp::pubConsensus (ConsensusPhase phase)
         jvObj [jss::type] = "consensusPhase";
         jvObj [jss::consensus] = to_string(phase);
 
+        auto const event = std::make_shared<InfoSub::Event const> (
+            std::move (jvObj));
+
         for (auto i = streamMap.begin ();
             i != streamMap.end (); )
         {
             if (auto p = i->second.lock())
             {
-                p->send (jvObj, true);
+                p->send (event, true);
                 ++i;
             }
             else
@@ -1812,12 +1821,15 @@ void NetworkOPsImp::pubValidation (STValidation::ref val)
         if (auto const reserveInc = (*val)[~sfReserveIncrement])
             jvObj [jss::reserve_inc] = *reserveInc;
 
+        auto const event = std::make_shared<InfoSub::Event const> (
+            std::move (jvObj));
+
         for (auto i = mStreamMaps[sValidations].begin ();
             i != mStreamMaps[sValidations].end (); )
         {
             if (auto p = i->second.lock())
             {
-                p->send (jvObj, true);
+                p->send (event, true);
                 ++i;
             }
             else
@@ -1839,6 +1851,9 @@ void NetworkOPsImp::pubPeerStatus (
 
         jvObj [jss::type]                  = "peerStatusChange";
 
+        auto const event = std::make_shared<InfoSub::Event const> (
+            std::move (jvObj));
+
         for (auto i = mStreamMaps[sPeerStatus].begin ();
             i != mStreamMaps[sPeerStatus].end (); )
         {
@@ -1846,7 +1861,7 @@ void NetworkOPsImp::pubPeerStatus (
 
             if (p)
             {
-                p->send (jvObj, true);
+                p->send (event, true);
                 ++i;
             }
             else
@@ -2457,7 +2472,8 @@ void NetworkOPsImp::pubProposedTransaction (
     std::shared_ptr<ReadView const> const& lpCurrent,
     std::shared_ptr<STTx const> const& stTxn, TER terResult)
 {
-    Json::Value jvObj   = transJson (*stTxn, terResult, false, lpCurrent);
+    auto const event = std::make_shared<InfoSub::Event const> (
+        transJson (*stTxn, terResult, false, lpCurrent));
 
     {
         std::lock_guard sl (mSubLock);
@@ -2469,7 +2485,7 @@ void NetworkOPsImp::pubProposedTransaction (
 
             if (p)
             {
-                p->send (jvObj, true);
+                p->send (event, true);
                 ++it;
             }
             else
@@ -2527,13 +2543,16 @@ void NetworkOPsImp::pubLedger (
                         = app_.getLedgerMaster ().getCompleteLedgers ();
             }
 
+            auto const event = std::make_shared<InfoSub::Event const> (
+                std::move (jvObj));
+
             auto it = mStreamMaps[sLedger].begin ();
             while (it != mStreamMaps[sLedger].end ())
             {
                 InfoSub::pointer p = it->second.lock ();
                 if (p)
                 {
-                    p->send (jvObj, true);
+                    p->send (event, true);
                     ++it;
                 }
                 else
@@ -2586,7 +2605,8 @@ Json::Value NetworkOPsImp::transJson(
     transResultInfo (terResult, sToken, sHuman);
 
     jvObj[jss::type]           = "transaction";
-    jvObj[jss::transaction]    = stTxn.getJson (JsonOptions::none);
+    jvObj[jss::transaction]    =
+        app_.getMasterTransaction ().getJson (stTxn);
 
     if (bValidated)
     {
@@ -2642,6 +2662,9 @@ void NetworkOPsImp::pubValidatedTransaction (
             jvObj[jss::meta], *alAccepted, stTxn, *txMeta);
     }
 
+    auto const event = std::make_shared<InfoSub::Event const> (
+        std::move (jvObj));
+
     {
         std::lock_guard sl (mSubLock);
 
@@ -2652,7 +2675,7 @@ void NetworkOPsImp::pubValidatedTransaction (
 
             if (p)
             {
-                p->send (jvObj, true);
+                p->send (event, true);
                 ++it;
             }
             else
@@ -2667,14 +2690,14 @@ void NetworkOPsImp::pubValidatedTransaction (
 
             if (p)
             {
-                p->send (jvObj, true);
+                p->send (event, true);
                 ++it;
             }
             else
                 it = mStreamMaps[sRTTransactions].erase (it);
         }
     }
-    app_.getOrderBookDB ().processTxn (alAccepted, alTx, jvObj);
+    app_.getOrderBookDB ().processTxn (alAccepted, alTx, event);
     pubAccountTransaction (alAccepted, alTx, true);
 }
 
@@ -2683,63 +2706,22 @@ void NetworkOPsImp::pubAccountTransaction (
     const AcceptedLedgerTx& alTx,
     bool bAccepted)
 {
+    // The account index is read without taking mSubLock, so publishing
+    // never waits on clients that are subscribing or unsubscribing.
+    if (!bAccepted && mSubRTAccount.empty ()) return;
+
     hash_set<InfoSub::pointer>  notify;
-    int                             iProposed   = 0;
-    int                             iAccepted   = 0;
+    std::size_t                     iProposed   = 0;
+    std::size_t                     iAccepted   = 0;
 
+    if (!mSubAccount.empty () || !mSubRTAccount.empty ())
     {
-        std::lock_guard sl (mSubLock);
-
-        if (!bAccepted && mSubRTAccount.empty ()) return;
-
-        if (!mSubAccount.empty () || (!mSubRTAccount.empty ()) )
+        for (auto const& affectedAccount: alTx.getAffected ())
         {
-            for (auto const& affectedAccount: alTx.getAffected ())
-            {
-                auto simiIt
-                        = mSubRTAccount.find (affectedAccount);
-                if (simiIt != mSubRTAccount.end ())
-                {
-                    auto it = simiIt->second.begin ();
+            iProposed += mSubRTAccount.collect (affectedAccount, notify);
 
-                    while (it != simiIt->second.end ())
-                    {
-                        InfoSub::pointer p = it->second.lock ();
-
-                        if (p)
-                        {
-                            notify.insert (p);
-                            ++it;
-                            ++iProposed;
-                        }
-                        else
-                            it = simiIt->second.erase (it);
-                    }
-                }
-
-                if (bAccepted)
-                {
-                    simiIt  = mSubAccount.find (affectedAccount);
-
-                    if (simiIt != mSubAccount.end ())
-                    {
-                        auto it = simiIt->second.begin ();
-                        while (it != simiIt->second.end ())
-                        {
-                            InfoSub::pointer p = it->second.lock ();
-
-                            if (p)
-                            {
-                                notify.insert (p);
-                                ++it;
-                                ++iAccepted;
-                            }
-                            else
-                                it = simiIt->second.erase (it);
-                        }
-                    }
-                }
-            }
+            if (bAccepted)
+                iAccepted += mSubAccount.collect (affectedAccount, notify);
         }
     }
     JLOG(m_journal.trace()) << "pubAccountTransaction:" <<
@@ -2762,8 +2744,11 @@ void NetworkOPsImp::pubAccountTransaction (
             }
         }
 
+        auto const event = std::make_shared<InfoSub::Event const> (
+            std::move (jvObj));
+
         for (InfoSub::ref isrListener : notify)
-            isrListener->send (jvObj, true);
+            isrListener->send (event, true);
     }
 }
 
@@ -2775,7 +2760,7 @@ void NetworkOPsImp::subAccount (
     InfoSub::ref isrListener,
     hash_set<AccountID> const& vnaAccountIDs, bool rt)
 {
-    SubInfoMapType& subMap = rt ? mSubRTAccount : mSubAccount;
+    auto& subMap = rt ? mSubRTAccount : mSubAccount;
 
     for (auto const& naAccountID : vnaAccountIDs)
     {
@@ -2783,27 +2768,7 @@ void NetworkOPsImp::subAccount (
             "subAccount: account: " << toBase58(naAccountID);
 
         isrListener->insertSubAccountInfo (naAccountID, rt);
-    }
-
-    std::lock_guard sl (mSubLock);
-
-    for (auto const& naAccountID : vnaAccountIDs)
-    {
-        auto simIterator = subMap.find (naAccountID);
-        if (simIterator == subMap.end ())
-        {
-            // Not found, note that account has a new single listner.
-            SubMapType  usisElement;
-            usisElement[isrListener->getSeq ()] = isrListener;
-            // VFALCO NOTE This is making a needless copy of naAccountID
-            subMap.insert (simIterator,
-                make_pair(naAccountID, usisElement));
-        }
-        else
-        {
-            // Found, note that the account has another listener.
-            simIterator->second[isrListener->getSeq ()] = isrListener;
-        }
+        subMap.insert (naAccountID, isrListener);
     }
 }
 
@@ -2827,26 +2792,10 @@ void NetworkOPsImp::unsubAccountInternal (
     hash_set<AccountID> const& vnaAccountIDs,
     bool rt)
 {
-    std::lock_guard sl (mSubLock);
-
-    SubInfoMapType& subMap = rt ? mSubRTAccount : mSubAccount;
+    auto& subMap = rt ? mSubRTAccount : mSubAccount;
 
     for (auto const& naAccountID : vnaAccountIDs)
-    {
-        auto simIterator = subMap.find (naAccountID);
-
-        if (simIterator != subMap.end ())
-        {
-            // Found
-            simIterator->second.erase (uSeq);
-
-            if (simIterator->second.empty ())
-            {
-                // Don't need hash entry.
-                subMap.erase (simIterator);
-            }
-        }
-    }
+        subMap.erase (naAccountID, uSeq);
 }
 
 bool NetworkOPsImp::subBook (InfoSub::ref isrListener, Book const& book)
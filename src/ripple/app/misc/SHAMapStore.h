@@ -64,6 +64,11 @@ public:
 
     /** Returns the number of file descriptors that are needed. */
     virtual int fdRequired() const = 0;
+
+    /** Statistics about the last rotation of backends, reported by
+        get_counts. Null if online delete is not enabled.
+    */
+    virtual Json::Value getJson() const = 0;
 };
 
 //------------------------------------------------------------------------------
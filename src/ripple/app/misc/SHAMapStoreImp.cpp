@@ -23,7 +23,9 @@
 #include <ripple/app/misc/SHAMapStoreImp.h>
 #include <ripple/beast/core/CurrentThreadName.h>
 #include <ripple/core/ConfigSections.h>
+#include <ripple/core/JobQueue.h>
 #include <ripple/nodestore/impl/DatabaseRotatingImp.h>
+#include <ripple/protocol/jss.h>
 
 #include <boost/algorithm/string/predicate.hpp>
 
@@ -313,6 +315,13 @@ SHAMapStoreImp::copyNode (std::uint64_t& nodeCount,
     {
         if (health())
             return false;
+        yieldToLoad();
+
+        if (! (nodeCount % (1000 * checkHealthInterval_)))
+        {
+            JLOG(journal_.info()) << "copying state map: "
+                << nodeCount << " nodes";
+        }
     }
 
     return true;
@@ -370,6 +379,8 @@ SHAMapStoreImp::run()
             JLOG(journal_.debug()) << "rotating  validatedSeq " << validatedSeq
                     << " lastRotated " << lastRotated << " deleteInterval "
                     << deleteInterval_ << " canDelete_ " << canDelete_;
+            backedOff_ = std::chrono::milliseconds {0};
+            backOffMs_ = 0;
 
             switch (health())
             {
@@ -397,12 +408,20 @@ SHAMapStoreImp::run()
             }
 
             std::uint64_t nodeCount = 0;
+            auto const copyStart = std::chrono::steady_clock::now();
             validatedLedger->stateMap().snapShot (
                     false)->visitNodes (
                     std::bind (&SHAMapStoreImp::copyNode, this,
                     std::ref(nodeCount), std::placeholders::_1));
-            JLOG(journal_.debug()) << "copied ledger " << validatedSeq
-                    << " nodecount " << nodeCount;
+            auto const copyTime =
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - copyStart);
+            copiedNodes_ = nodeCount;
+            copyMs_ = copyTime.count();
+            JLOG(journal_.info()) << "copied ledger " << validatedSeq
+                    << " nodecount " << nodeCount << " in "
+                    << std::chrono::duration_cast<std::chrono::seconds>(
+                        copyTime).count() << "s";
             switch (health())
             {
                 case Health::stopping:
@@ -668,6 +687,41 @@ SHAMapStoreImp::clearPrior (LedgerIndex lastRotated)
         return;
 }
 
+void
+SHAMapStoreImp::yieldToLoad()
+{
+    if (backedOff_ >= maxBackOff_ || ! app_.getJobQueue().isOverloaded())
+        return;
+
+    std::this_thread::sleep_for (
+        std::chrono::milliseconds (backOff_));
+    backedOff_ += std::chrono::milliseconds (backOff_);
+    backOffMs_ = backedOff_.count();
+
+    if (backedOff_ >= maxBackOff_)
+    {
+        ++backOffLimitHits_;
+        JLOG(journal_.warn()) << "online delete backed off for "
+            << std::chrono::duration_cast<std::chrono::seconds>(
+                backedOff_).count()
+            << "s under load, finishing the rotation without backing off";
+    }
+}
+
+Json::Value
+SHAMapStoreImp::getJson() const
+{
+    if (! deleteInterval_)
+        return {};
+
+    Json::Value ret (Json::objectValue);
+    ret[jss::copied_nodes] = std::to_string (copiedNodes_.load());
+    ret[jss::copy_ms] = std::to_string (copyMs_.load());
+    ret[jss::back_off_ms] = std::to_string (backOffMs_.load());
+    ret[jss::back_off_limit_hits] = backOffLimitHits_.load();
+    return ret;
+}
+
 SHAMapStoreImp::Health
 SHAMapStoreImp::health()
 {
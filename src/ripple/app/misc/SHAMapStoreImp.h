@@ -25,6 +25,8 @@
 #include <ripple/core/DatabaseCon.h>
 #include <ripple/nodestore/DatabaseRotating.h>
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <thread>
 
@@ -80,6 +82,8 @@ private:
     std::string const dbPrefix_ = "rippledb";
     // check health/stop status as records are copied
     std::uint64_t const checkHealthInterval_ = 1000;
+    // most time one rotation may spend backing off for load
+    std::chrono::seconds const maxBackOff_ {std::chrono::minutes {5}};
     // minimum # of ledgers to maintain for health of network
     static std::uint32_t const minimumDeletionInterval_ = 256;
     // minimum # of ledgers required for standalone mode.
@@ -106,6 +110,15 @@ private:
     std::uint32_t backOff_ = 100;
     std::int32_t ageThreshold_ = 60;
 
+    // time spent backing off for load during the current rotation
+    std::chrono::milliseconds backedOff_ {0};
+
+    // statistics about the last rotation, reported by get_counts
+    std::atomic<std::uint64_t> copiedNodes_ {0};
+    std::atomic<std::uint64_t> copyMs_ {0};
+    std::atomic<std::uint64_t> backOffMs_ {0};
+    std::atomic<std::uint32_t> backOffLimitHits_ {0};
+
     // these do not exist upon SHAMapStore creation, but do exist
     // as of onPrepare() or before
     NetworkOPs* netOPs_ = nullptr;
@@ -175,6 +188,8 @@ public:
     void rendezvous() const override;
     int fdRequired() const override;
 
+    Json::Value getJson() const override;
+
 private:
     // callback for visitNodes
     bool copyNode (std::uint64_t& nodeCount, SHAMapAbstractNode const &node);
@@ -193,8 +208,12 @@ private:
         for (auto const& key: cache.getKeys())
         {
             dbRotating_->fetch(key, 0);
-            if (! (++check % checkHealthInterval_) && health())
-                return true;
+            if (! (++check % checkHealthInterval_))
+            {
+                if (health())
+                    return true;
+                yieldToLoad();
+            }
         }
 
         return false;
@@ -212,6 +231,11 @@ private:
     void freshenCaches();
     void clearPrior (LedgerIndex lastRotated);
 
+    // Background copying gives way to live traffic: while the job queue
+    // is overloaded, wait backOff_ before the next batch of nodes. Once a
+    // rotation has waited maxBackOff_ in total it copies at full speed.
+    void yieldToLoad();
+
     // If rippled is not healthy, defer rotate-delete.
     // If already unhealthy, do not change state on further check.
     // Assume that, once unhealthy, a necessary step has been
@@ -0,0 +1,95 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2019 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <ripple/app/misc/impl/AccountSubscriptions.h>
+
+namespace ripple {
+
+void
+AccountSubscriptions::insert(AccountID const& account, InfoSub::ref listener)
+{
+    auto& p = partition(account);
+    std::lock_guard lock(p.mutex);
+
+    auto& slot = p.map[account];
+    auto next = slot ?
+        std::make_shared<Listeners>(*slot) :
+        std::make_shared<Listeners>();
+    (*next)[listener->getSeq()] = listener;
+
+    if (! slot)
+        ++accounts_;
+    slot = std::move(next);
+}
+
+void
+AccountSubscriptions::erase(AccountID const& account, std::uint64_t seq)
+{
+    auto& p = partition(account);
+    std::lock_guard lock(p.mutex);
+
+    auto const it = p.map.find(account);
+    if (it == p.map.end() || it->second->count(seq) == 0)
+        return;
+
+    if (it->second->size() == 1)
+    {
+        p.map.erase(it);
+        --accounts_;
+        return;
+    }
+
+    auto next = std::make_shared<Listeners>(*it->second);
+    next->erase(seq);
+    it->second = std::move(next);
+}
+
+std::shared_ptr<AccountSubscriptions::Listeners const>
+AccountSubscriptions::find(AccountID const& account) const
+{
+    auto& p = partition(account);
+    std::lock_guard lock(p.mutex);
+
+    auto const it = p.map.find(account);
+    if (it == p.map.end())
+        return nullptr;
+    return it->second;
+}
+
+std::size_t
+AccountSubscriptions::collect(AccountID const& account,
+    hash_set<InfoSub::pointer>& listeners) const
+{
+    auto const snapshot = find(account);
+    if (! snapshot)
+        return 0;
+
+    std::size_t found = 0;
+    for (auto const& entry : *snapshot)
+    {
+        if (auto p = entry.second.lock())
+        {
+            listeners.insert(std::move(p));
+            ++found;
+        }
+    }
+    return found;
+}
+
+} // ripple
@@ -0,0 +1,106 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2019 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#ifndef RIPPLE_APP_MISC_IMPL_ACCOUNTSUBSCRIPTIONS_H_INCLUDED
+#define RIPPLE_APP_MISC_IMPL_ACCOUNTSUBSCRIPTIONS_H_INCLUDED
+
+#include <ripple/basics/UnorderedContainers.h>
+#include <ripple/net/InfoSub.h>
+#include <ripple/protocol/AccountID.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace ripple {
+
+/** Account stream subscribers, indexed for the publish path.
+
+    The listeners for an account are kept in an immutable set that is
+    replaced, never modified, when a client subscribes or unsubscribes.
+    Publishing takes a snapshot of the set under a short lock on one
+    partition of the index and delivers without holding any lock, so
+    subscription changes on other accounts never stall a publisher.
+
+    Listeners that have gone away are not pruned on the publish path;
+    InfoSub removes its own entries when it is destroyed.
+*/
+class AccountSubscriptions
+{
+public:
+    using Listeners = hash_map<std::uint64_t, InfoSub::wptr>;
+
+    AccountSubscriptions() = default;
+    AccountSubscriptions(AccountSubscriptions const&) = delete;
+    AccountSubscriptions& operator=(AccountSubscriptions const&) = delete;
+
+    /** Add a listener to an account. */
+    void
+    insert(AccountID const& account, InfoSub::ref listener);
+
+    /** Remove a listener from an account. */
+    void
+    erase(AccountID const& account, std::uint64_t seq);
+
+    /** Returns `true` if no account has any listener. */
+    bool
+    empty() const
+    {
+        return accounts_.load() == 0;
+    }
+
+    /** Snapshot the listeners of an account.
+
+        @return The set of listeners, or `nullptr` if there are none.
+    */
+    std::shared_ptr<Listeners const>
+    find(AccountID const& account) const;
+
+    /** Add the live listeners of an account to a set.
+
+        @return The number of live listeners found.
+    */
+    std::size_t
+    collect(AccountID const& account,
+        hash_set<InfoSub::pointer>& listeners) const;
+
+private:
+    static constexpr std::size_t partitions = 16;
+
+    struct Partition
+    {
+        std::mutex mutex;
+        hash_map<AccountID, std::shared_ptr<Listeners const>> map;
+    };
+
+    Partition&
+    partition(AccountID const& account) const
+    {
+        // Account IDs are hashes, so any byte spreads them evenly.
+        return partitions_[*account.begin() % partitions];
+    }
+
+    mutable std::array<Partition, partitions> partitions_;
+    std::atomic<std::size_t> accounts_{0};
+};
+
+} // ripple
+
+#endif
@@ -114,6 +114,27 @@ accountTxPage (
     // we need to clear it in between.
     token = Json::nullValue;
 
+    // Rows only ever come from [minLedger, maxLedger]. A marker before
+    // the range, in the direction of travel, resumes from its start; a
+    // marker past the range has nothing left to return.
+    if (findLedger != 0)
+    {
+        std::int64_t const marker = findLedger;
+        if (forward ? marker > maxLedger : marker < minLedger)
+            return;
+        if (forward ? marker < minLedger : marker > maxLedger)
+        {
+            lookingForMarker = false;
+            findLedger = findSeq = 0;
+        }
+    }
+
+    // Every query below is a range scan of AcctTxIndex
+    // (Account, LedgerSeq, TxnSeq, TransID) in the requested order, so
+    // SQLite can stop after queryLimit rows instead of collecting and
+    // sorting the account's whole history. Resuming from a marker is
+    // expressed as a single index range plus a filter on the boundary
+    // ledger; an OR of two ranges defeats the index ordering.
     static std::string const prefix (
         R"(SELECT AccountTransactions.LedgerSeq,AccountTransactions.TxnSeq,
           Status,RawTxn,TxnMeta
@@ -126,92 +147,55 @@ accountTxPage (
 
     // SQL's BETWEEN uses a closed interval ([a,b])
 
-    if (forward && (findLedger == 0))
+    if (findLedger == 0)
     {
         sql = boost::str (boost::format(
             prefix +
             (R"(AccountTransactions.LedgerSeq BETWEEN '%u' AND '%u'
-             ORDER BY AccountTransactions.LedgerSeq ASC,
-             AccountTransactions.TxnSeq ASC
+             ORDER BY AccountTransactions.LedgerSeq %s,
+             AccountTransactions.TxnSeq %s
              LIMIT %u;)"))
             % idCache.toBase58(account)
             % minLedger
             % maxLedger
+            % (forward ? "ASC" : "DESC")
+            % (forward ? "ASC" : "DESC")
             % queryLimit);
     }
-    else if (forward && (findLedger != 0))
-    {
-        auto b58acct = idCache.toBase58(account);
-        sql = boost::str (boost::format(
-            (R"(SELECT AccountTransactions.LedgerSeq,AccountTransactions.TxnSeq,
-            Status,RawTxn,TxnMeta
-            FROM AccountTransactions, Transactions WHERE
-            (AccountTransactions.TransID = Transactions.TransID AND
-            AccountTransactions.Account = '%s' AND
-            AccountTransactions.LedgerSeq BETWEEN '%u' AND '%u')
-            OR
-            (AccountTransactions.TransID = Transactions.TransID AND
-            AccountTransactions.Account = '%s' AND
-            AccountTransactions.LedgerSeq = '%u' AND
-            AccountTransactions.TxnSeq >= '%u')
-            ORDER BY AccountTransactions.LedgerSeq ASC,
-            AccountTransactions.TxnSeq ASC
-            LIMIT %u;
-            )"))
-        % b58acct
-        % (findLedger + 1)
-        % maxLedger
-        % b58acct
-        % findLedger
-        % findSeq
-        % queryLimit);
-    }
-    else if (!forward && (findLedger == 0))
+    else if (forward)
     {
         sql = boost::str (boost::format(
             prefix +
             (R"(AccountTransactions.LedgerSeq BETWEEN '%u' AND '%u'
-             ORDER BY AccountTransactions.LedgerSeq DESC,
-             AccountTransactions.TxnSeq DESC
+             AND (AccountTransactions.LedgerSeq > '%u' OR
+                  AccountTransactions.TxnSeq >= '%u')
+             ORDER BY AccountTransactions.LedgerSeq ASC,
+             AccountTransactions.TxnSeq ASC
              LIMIT %u;)"))
             % idCache.toBase58(account)
-            % minLedger
+            % findLedger
             % maxLedger
+            % findLedger
+            % findSeq
             % queryLimit);
     }
-    else if (!forward && (findLedger != 0))
+    else
     {
-        auto b58acct = idCache.toBase58(account);
         sql = boost::str (boost::format(
-            (R"(SELECT AccountTransactions.LedgerSeq,AccountTransactions.TxnSeq,
-            Status,RawTxn,TxnMeta
-            FROM AccountTransactions, Transactions WHERE
-            (AccountTransactions.TransID = Transactions.TransID AND
-            AccountTransactions.Account = '%s' AND
-            AccountTransactions.LedgerSeq BETWEEN '%u' AND '%u')
-            OR
-            (AccountTransactions.TransID = Transactions.TransID AND
-            AccountTransactions.Account = '%s' AND
-            AccountTransactions.LedgerSeq = '%u' AND
-            AccountTransactions.TxnSeq <= '%u')
-            ORDER BY AccountTransactions.LedgerSeq DESC,
-            AccountTransactions.TxnSeq DESC
-            LIMIT %u;
-            )"))
-            % b58acct
+            prefix +
+            (R"(AccountTransactions.LedgerSeq BETWEEN '%u' AND '%u'
+             AND (AccountTransactions.LedgerSeq < '%u' OR
+                  AccountTransactions.TxnSeq <= '%u')
+             ORDER BY AccountTransactions.LedgerSeq DESC,
+             AccountTransactions.TxnSeq DESC
+             LIMIT %u;)"))
+            % idCache.toBase58(account)
             % minLedger
-            % (findLedger - 1)
-            % b58acct
+            % findLedger
             % findLedger
             % findSeq
             % queryLimit);
     }
-    else
-    {
-        assert (false);
-        // sql is empty
-        return;
-    }
 
     {
         auto db (connection.checkoutDb());
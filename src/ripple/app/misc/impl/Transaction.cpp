@@ -22,6 +22,7 @@
 #include <ripple/basics/Log.h>
 #include <ripple/core/DatabaseCon.h>
 #include <ripple/app/ledger/LedgerMaster.h>
+#include <ripple/app/ledger/TransactionMaster.h>
 #include <ripple/app/main/Application.h>
 #include <ripple/app/misc/HashRouter.h>
 #include <ripple/basics/safe_cast.h>
@@ -147,7 +148,9 @@ Transaction::pointer Transaction::load(uint256 const& id, Application& app)
 // options 1 to include the date of the transaction
 Json::Value Transaction::getJson (JsonOptions options, bool binary) const
 {
-    Json::Value ret (mTransaction->getJson (JsonOptions::none, binary));
+    Json::Value ret (binary ?
+        mTransaction->getJson (JsonOptions::none, binary) :
+        mApp.getMasterTransaction ().getJson (*mTransaction));
 
     if (mInLedger)
     {
@@ -25,6 +25,7 @@
 #include <ripple/beast/clock/abstract_clock.h>
 #include <ripple/beast/insight/Insight.h>
 #include <mutex>
+#include <vector>
 
 namespace ripple {
 
@@ -162,6 +163,21 @@ public:
         m_stats.misses = 0;
     }
 
+    /** Returns a snapshot of the keys in the container. */
+    std::vector <key_type> getKeys () const
+    {
+        std::vector <key_type> v;
+
+        {
+            std::lock_guard lock (m_mutex);
+            v.reserve (m_map.size ());
+            for (auto const& _ : m_map)
+                v.push_back (_.first);
+        }
+
+        return v;
+    }
+
     void setTargetSize (size_type s)
     {
         std::lock_guard lock (m_mutex);
@@ -357,6 +357,11 @@ class LedgerTrie
     // Count of the tip support for each sequence number
     std::map<Seq, std::uint32_t> seqSupport;
 
+    // The last result of getPreferred and the largestIssued it was computed
+    // for. Any change in support clears it.
+    mutable boost::optional<Seq> preferredSeq;
+    mutable boost::optional<SpanTip<Ledger>> preferredTip;
+
     /** Find the node in the trie that represents the longest common ancestry
         with the given ledger.
 
@@ -417,6 +422,109 @@ class LedgerTrie
         return nullptr;
     }
 
+    void
+    invalidatePreferred()
+    {
+        preferredSeq = boost::none;
+        preferredTip = boost::none;
+    }
+
+    boost::optional<SpanTip<Ledger>>
+    computePreferred(Seq const largestIssued) const
+    {
+        if (empty())
+            return boost::none;
+
+        Node* curr = root.get();
+
+        bool done = false;
+
+        std::uint32_t uncommitted = 0;
+        auto uncommittedIt = seqSupport.begin();
+
+        while (curr && !done)
+        {
+            // Within a single span, the preferred by branch strategy is simply
+            // to continue along the span as long as the branch support of
+            // the next ledger exceeds the uncommitted support for that ledger.
+            {
+                // Add any initial uncommitted support prior for ledgers
+                // earlier than nextSeq or earlier than largestIssued
+                Seq nextSeq = curr->span.start() + Seq{1};
+                while (uncommittedIt != seqSupport.end() &&
+                       uncommittedIt->first < std::max(nextSeq, largestIssued))
+                {
+                    uncommitted += uncommittedIt->second;
+                    uncommittedIt++;
+                }
+
+                // Advance nextSeq along the span
+                while (nextSeq < curr->span.end() &&
+                       curr->branchSupport > uncommitted)
+                {
+                    // Jump to the next seqSupport change
+                    if (uncommittedIt != seqSupport.end() &&
+                        uncommittedIt->first < curr->span.end())
+                    {
+                        nextSeq = uncommittedIt->first + Seq{1};
+                        uncommitted += uncommittedIt->second;
+                        uncommittedIt++;
+                    }
+                    else  // otherwise we jump to the end of the span
+                        nextSeq = curr->span.end();
+                }
+                // We did not consume the entire span, so we have found the
+                // preferred ledger
+                if (nextSeq < curr->span.end())
+                    return curr->span.before(nextSeq)->tip();
+            }
+
+            // We have reached the end of the current span, so we need to
+            // find the best child
+            Node* best = nullptr;
+            std::uint32_t margin = 0;
+            if (curr->children.size() == 1)
+            {
+                best = curr->children[0].get();
+                margin = best->branchSupport;
+            }
+            else if (!curr->children.empty())
+            {
+                // Sort placing children with largest branch support in the
+                // front, breaking ties with the span's starting ID
+                std::partial_sort(
+                    curr->children.begin(),
+                    curr->children.begin() + 2,
+                    curr->children.end(),
+                    [](std::unique_ptr<Node> const& a,
+                       std::unique_ptr<Node> const& b) {
+                        return std::make_tuple(
+                                   a->branchSupport, a->span.startID()) >
+                            std::make_tuple(
+                                   b->branchSupport, b->span.startID());
+                    });
+
+                best = curr->children[0].get();
+                margin = curr->children[0]->branchSupport -
+                    curr->children[1]->branchSupport;
+
+                // If best holds the tie-breaker, gets one larger margin
+                // since the second best needs additional branchSupport
+                // to overcome the tie
+                if (best->span.startID() > curr->children[1]->span.startID())
+                    margin++;
+            }
+
+            // If the best child has margin exceeding the uncommitted support,
+            // continue from that child, otherwise we are done
+            if (best && ((margin > uncommitted) || (uncommitted == 0)))
+                curr = best;
+            else  // current is the best
+                done = true;
+        }
+        return curr->span.tip();
+    }
+
     void
     dumpImpl(std::ostream& o, std::unique_ptr<Node> const& curr, int offset)
         const
@@ -521,6 +629,7 @@ public:
         }
 
         seqSupport[ledger.seq()] += count;
+        invalidatePreferred();
     }
 
     /** Decrease support for a ledger, removing and compressing if possible.
@@ -538,6 +647,8 @@ public:
         if (!loc || loc->tipSupport == 0)
             return false;
 
+        invalidatePreferred();
+
         // found our node, remove it
         count = std::min(count, loc->tipSupport);
         loc->tipSupport -= count;
@@ -672,101 +783,21 @@ public:
                              issued by this node.
         @return Pair with the sequence number and ID of the preferred ledger or
                 boost::none if no preferred ledger exists
+
+        @note The result is remembered until the next insert or remove, so
+              repeated calls with the same largestIssued do not walk the trie.
     */
     boost::optional<SpanTip<Ledger>>
     getPreferred(Seq const largestIssued) const
     {
-        if (empty())
-            return boost::none;
-
-        Node* curr = root.get();
-
-        bool done = false;
-
-        std::uint32_t uncommitted = 0;
-        auto uncommittedIt = seqSupport.begin();
-
-        while (curr && !done)
+        if (preferredSeq != largestIssued)
         {
-            // Within a single span, the preferred by branch strategy is simply
-            // to continue along the span as long as the branch support of
-            // the next ledger exceeds the uncommitted support for that ledger.
-            {
-                // Add any initial uncommitted support prior for ledgers
-                // earlier than nextSeq or earlier than largestIssued
-                Seq nextSeq = curr->span.start() + Seq{1};
-                while (uncommittedIt != seqSupport.end() &&
-                       uncommittedIt->first < std::max(nextSeq, largestIssued))
-                {
-                    uncommitted += uncommittedIt->second;
-                    uncommittedIt++;
-                }
-
-                // Advance nextSeq along the span
-                while (nextSeq < curr->span.end() &&
-                       curr->branchSupport > uncommitted)
-                {
-                    // Jump to the next seqSupport change
-                    if (uncommittedIt != seqSupport.end() &&
-                        uncommittedIt->first < curr->span.end())
-                    {
-                        nextSeq = uncommittedIt->first + Seq{1};
-                        uncommitted += uncommittedIt->second;
-                        uncommittedIt++;
-                    }
-                    else  // otherwise we jump to the end of the span
-                        nextSeq = curr->span.end();
-                }
-                // We did not consume the entire span, so we have found the
-                // preferred ledger
-                if (nextSeq < curr->span.end())
-                    return curr->span.before(nextSeq)->tip();
-            }
-
-            // We have reached the end of the current span, so we need to
-            // find the best child
-            Node* best = nullptr;
-            std::uint32_t margin = 0;
-            if (curr->children.size() == 1)
-            {
-                best = curr->children[0].get();
-                margin = best->branchSupport;
-            }
-            else if (!curr->children.empty())
-            {
-                // Sort placing children with largest branch support in the
-                // front, breaking ties with the span's starting ID
-                std::partial_sort(
-                    curr->children.begin(),
-                    curr->children.begin() + 2,
-                    curr->children.end(),
-                    [](std::unique_ptr<Node> const& a,
-                       std::unique_ptr<Node> const& b) {
-                        return std::make_tuple(
-                                   a->branchSupport, a->span.startID()) >
-                            std::make_tuple(
-                                   b->branchSupport, b->span.startID());
-                    });
-
-                best = curr->children[0].get();
-                margin = curr->children[0]->branchSupport -
-                    curr->children[1]->branchSupport;
-
-                // If best holds the tie-breaker, gets one larger margin
-                // since the second best needs additional branchSupport
-                // to overcome the tie
-                if (best->span.startID() > curr->children[1]->span.startID())
-                    margin++;
-            }
-
-            // If the best child has margin exceeding the uncommitted support,
-            // continue from that child, otherwise we are done
-            if (best && ((margin > uncommitted) || (uncommitted == 0)))
-                curr = best;
-            else  // current is the best
-                done = true;
+            preferredTip = boost::none;
+            if (auto tip = computePreferred(largestIssued))
+                preferredTip.emplace(std::move(*tip));
+            preferredSeq = largestIssued;
         }
-        return curr->span.tip();
+        return preferredTip;
     }
 
     /** Return whether the trie is tracking any ledgers
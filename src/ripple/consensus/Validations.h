@@ -28,6 +28,7 @@
 #include <ripple/consensus/LedgerTrie.h>
 #include <ripple/protocol/PublicKey.h>
 #include <boost/optional.hpp>
+#include <memory>
 #include <mutex>
 #include <utility>
 #include <vector>
@@ -306,6 +307,13 @@ class Validations
         beast::uhash<>>
         byLedger_;
 
+    // Trusted full validations of each ledger in byLedger_, published as
+    // an immutable snapshot. Writers replace it while holding mutex_;
+    // readers load it without taking mutex_.
+    using LedgerVotes = std::vector<Validation>;
+    using VoteMap = hash_map<ID, std::shared_ptr<LedgerVotes const>>;
+    std::shared_ptr<VoteMap const> votes_;
+
     // Represents the ancestry of validated ledgers
     LedgerTrie<Ledger> trie_;
 
@@ -496,31 +504,62 @@ private:
         }
     }
 
-    /** Iterate the set of validations associated with a given ledger id
+    // Gather the trusted full validations from one ledger's set
+    static
+    std::shared_ptr<LedgerVotes const>
+    makeVotes(hash_map<NodeID, Validation> const& validations)
+    {
+        auto votes = std::make_shared<LedgerVotes>();
+        for (auto const& [_, v] : validations)
+        {
+            (void)_;
+            if (v.trusted() && v.full())
+                votes->push_back(v);
+        }
+        return votes;
+    }
 
-        @param lock Existing lock on mutex_
-        @param ledgerID The identifier of the ledger
-        @param pre Invokable with signature(std::size_t)
-        @param f Invokable with signature (NodeID const &, Validation const &)
+    // Publish the votes for one ledger after its set changed
+    void
+    publishVotes(
+        std::lock_guard<Mutex> const&,
+        ID const& ledgerID,
+        hash_map<NodeID, Validation> const& validations)
+    {
+        auto next = std::make_shared<VoteMap>(*std::atomic_load(&votes_));
+        auto votes = makeVotes(validations);
+        if (votes->empty())
+            next->erase(ledgerID);
+        else
+            (*next)[ledgerID] = std::move(votes);
+        std::atomic_store(
+            &votes_, std::shared_ptr<VoteMap const>(std::move(next)));
+    }
 
-        @note The invokable `pre` is called prior to iterating validations. The
-              argument is the number of times `f` will be called.
-        @warning The invokable f is expected to be a simple transformation of
-       its arguments and will be called with mutex_ under lock.
-    */
-    template <class Pre, class F>
+    // Publish the votes for every ledger after trust or expiration changes
     void
-    byLedger(std::lock_guard<Mutex> const&, ID const& ledgerID, Pre&& pre, F&& f)
+    publishAllVotes(std::lock_guard<Mutex> const&)
     {
-        auto it = byLedger_.find(ledgerID);
-        if (it != byLedger_.end())
+        auto next = std::make_shared<VoteMap>();
+        for (auto const& [ledgerID, validations] : byLedger_)
         {
-            // Update set time since it is being used
-            byLedger_.touch(it);
-            pre(it->second.size());
-            for (auto const& [key, val] : it->second)
-                f(key, val);
+            auto votes = makeVotes(validations);
+            if (!votes->empty())
+                next->emplace(ledgerID, std::move(votes));
         }
+        std::atomic_store(
+            &votes_, std::shared_ptr<VoteMap const>(std::move(next)));
+    }
+
+    // The published votes for a ledger, or nullptr if it has none
+    std::shared_ptr<LedgerVotes const>
+    trustedVotes(ID const& ledgerID) const
+    {
+        auto const votes = std::atomic_load(&votes_);
+        auto const it = votes->find(ledgerID);
+        if (it == votes->end())
+            return nullptr;
+        return it->second;
     }
 
 public:
@@ -535,7 +574,10 @@ public:
         ValidationParms const& p,
         beast::abstract_clock<std::chrono::steady_clock>& c,
         Ts&&... ts)
-        : byLedger_(c), parms_(p), adaptor_(std::forward<Ts>(ts)...)
+        : byLedger_(c)
+        , votes_(std::make_shared<VoteMap const>())
+        , parms_(p)
+        , adaptor_(std::forward<Ts>(ts)...)
     {
     }
 
@@ -593,7 +635,13 @@ public:
             if (!enforcer(now, val.seq(), parms_))
                 return ValStatus::badSeq;
 
-            byLedger_[val.ledgerID()].insert_or_assign(nodeID, val);
+            auto& validations = byLedger_[val.ledgerID()];
+            auto const prior = validations.find(nodeID);
+            bool const priorTrusted =
+                prior != validations.end() && prior->second.trusted();
+            validations.insert_or_assign(nodeID, val);
+            if (val.trusted() || priorTrusted)
+                publishVotes(lock, val.ledgerID(), validations);
 
             auto const [it, inserted] = current_.emplace(nodeID, val);
             if (!inserted)
@@ -628,6 +676,7 @@ public:
     {
         std::lock_guard lock{mutex_};
         beast::expire(byLedger_, parms_.validationSET_EXPIRES);
+        publishAllVotes(lock);
     }
 
     /** Update trust status of validations
@@ -673,6 +722,7 @@ public:
                 }
             }
         }
+        publishAllVotes(lock);
     }
 
     Json::Value
@@ -882,19 +932,10 @@ public:
         @return The number of trusted validations
     */
     std::size_t
-    numTrustedForLedger(ID const& ledgerID)
+    numTrustedForLedger(ID const& ledgerID) const
     {
-        std::size_t count = 0;
-        std::lock_guard lock{mutex_};
-        byLedger(
-            lock,
-            ledgerID,
-            [&](std::size_t) {},  // nothing to reserve
-            [&](NodeID const&, Validation const& v) {
-                if (v.trusted() && v.full())
-                    ++count;
-            });
-        return count;
+        auto const votes = trustedVotes(ledgerID);
+        return votes ? votes->size() : 0;
     }
 
     /**  Get trusted full validations for a specific ledger
@@ -903,19 +944,15 @@ public:
          @return Trusted validations associated with ledger
     */
     std::vector<WrappedValidationType>
-    getTrustedForLedger(ID const& ledgerID)
+    getTrustedForLedger(ID const& ledgerID) const
     {
         std::vector<WrappedValidationType> res;
-        std::lock_guard lock{mutex_};
-        byLedger(
-            lock,
-            ledgerID,
-            [&](std::size_t numValidations) { res.reserve(numValidations); },
-            [&](NodeID const&, Validation const& v) {
-                if (v.trusted() && v.full())
-                    res.emplace_back(v.unwrap());
-            });
-
+        if (auto const votes = trustedVotes(ledgerID))
+        {
+            res.reserve(votes->size());
+            for (auto const& v : *votes)
+                res.emplace_back(v.unwrap());
+        }
         return res;
     }
 
@@ -926,24 +963,21 @@ public:
         @return Vector of fees
     */
     std::vector<std::uint32_t>
-    fees(ID const& ledgerID, std::uint32_t baseFee)
+    fees(ID const& ledgerID, std::uint32_t baseFee) const
     {
         std::vector<std::uint32_t> res;
-        std::lock_guard lock{mutex_};
-        byLedger(
-            lock,
-            ledgerID,
-            [&](std::size_t numValidations) { res.reserve(numValidations); },
-            [&](NodeID const&, Validation const& v) {
-                if (v.trusted() && v.full())
-                {
-                    boost::optional<std::uint32_t> loadFee = v.loadFee();
-                    if (loadFee)
-                        res.push_back(*loadFee);
-                    else
-                        res.push_back(baseFee);
-                }
-            });
+        if (auto const votes = trustedVotes(ledgerID))
+        {
+            res.reserve(votes->size());
+            for (auto const& v : *votes)
+            {
+                boost::optional<std::uint32_t> loadFee = v.loadFee();
+                if (loadFee)
+                    res.push_back(*loadFee);
+                else
+                    res.push_back(baseFee);
+            }
+        }
         return res;
     }
 
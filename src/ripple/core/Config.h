@@ -134,6 +134,8 @@ public:
     bool doImport = false;
     bool nodeToShard = false;
     bool validateShards = false;
+    // First and last sequence of the stored ledgers to replay at startup
+    boost::optional<std::pair<std::uint32_t, std::uint32_t>> replayRange;
     bool ELB_SUPPORT = false;
 
     std::vector<std::string>    IPS;                    // Peer IPs from rippled.cfg.
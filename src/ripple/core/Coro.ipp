@@ -42,7 +42,8 @@ Coro(Coro_create_t, JobQueue& jq, JobType type,
 #ifndef NDEBUG
             finished_ = true;
 #endif
-        }, boost::coroutines::attributes (megabytes(1)))
+        }, boost::coroutines::attributes (megabytes(1)),
+        StackAllocator{*this})
 {
 }
 
@@ -64,6 +65,7 @@ yield() const
         std::lock_guard lock(jq_.m_mutex);
         ++jq_.nSuspend_;
     }
+    releaseStack();
     (*yield_)();
 }
 
@@ -28,6 +28,8 @@
 #include <ripple/core/impl/Workers.h>
 #include <ripple/json/json_value.h>
 #include <boost/coroutine/all.hpp>
+#include <deque>
+#include <vector>
 
 namespace ripple {
 
@@ -69,12 +71,31 @@ public:
         std::mutex mutex_;
         std::mutex mutex_run_;
         std::condition_variable cv_;
+        boost::coroutines::stack_context stack_;
         boost::coroutines::asymmetric_coroutine<void>::pull_type coro_;
         boost::coroutines::asymmetric_coroutine<void>::push_type* yield_;
     #ifndef NDEBUG
         bool finished_ = false;
     #endif
 
+        // Allocates guarded stacks from the OS and remembers where the
+        // stack is, so that a suspended Coro can give back what it
+        // no longer uses.
+        struct StackAllocator
+        {
+            Coro& coro;
+
+            void allocate (boost::coroutines::stack_context& ctx,
+                std::size_t size);
+            void deallocate (boost::coroutines::stack_context& ctx);
+        };
+
+        // Returns the stack pages below the current frame to the OS.
+        // Deep calls made before a yield, such as a large ledger or
+        // path lookup, would otherwise stay resident for as long as
+        // the Coro is suspended.
+        void releaseStack() const;
+
     public:
         // Private: Used in the implementation
         template <class F>
@@ -218,7 +239,14 @@ private:
     beast::Journal m_journal;
     mutable std::mutex m_mutex;
     std::uint64_t m_lastJob;
-    std::set <Job> m_jobSet;
+
+    // Waiting jobs, one FIFO per job type, indexed by JobType. Scanning
+    // the types from the highest priority down yields the same order as
+    // a set sorted by priority and then sequence, without a tree node
+    // per job.
+    std::vector <std::deque <Job>> m_jobQueues;
+    std::size_t m_jobCount = 0;
+
     JobDataMap m_jobData;
     JobTypeData m_invalidJobData;
 
@@ -261,7 +289,7 @@ private:
     //
     // Pre-conditions:
     //  The JobType must be valid.
-    //  The Job must exist in mJobSet.
+    //  The Job must be at the back of the queue for its type.
     //  The Job must not have previously been queued.
     //
     // Post-conditions:
@@ -275,15 +303,15 @@ private:
     // Returns the next Job we should run now.
     //
     // RunnableJob:
-    //  A Job in the JobSet whose slots count for its type is greater than zero.
+    //  A waiting Job whose slots count for its type is greater than zero.
     //
     // Pre-conditions:
-    //  mJobSet must not be empty.
-    //  mJobSet holds at least one RunnableJob
+    //  m_jobCount must not be zero.
+    //  The queues hold at least one RunnableJob
     //
     // Post-conditions:
     //  job is a valid Job object.
-    //  job is removed from mJobQueue.
+    //  job is removed from the queue for its type.
     //  Waiting job count of its type is decremented
     //  Running job count of its type is incremented
     //
@@ -294,7 +322,7 @@ private:
     // Indicates that a running Job has completed its task.
     //
     // Pre-conditions:
-    //  Job must not exist in mJobSet.
+    //  Job must not be waiting in a queue.
     //  The JobType must not be invalid.
     //
     // Post-conditions:
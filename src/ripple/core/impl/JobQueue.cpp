@@ -20,9 +20,61 @@
 #include <ripple/core/JobQueue.h>
 #include <ripple/basics/contract.h>
 #include <ripple/basics/PerfLog.h>
+#include <boost/predef.h>
+#include <cstdint>
+
+#if ! BOOST_OS_WINDOWS
+#include <sys/mman.h>
+#endif
 
 namespace ripple {
 
+void
+JobQueue::Coro::StackAllocator::allocate (
+    boost::coroutines::stack_context& ctx, std::size_t size)
+{
+    boost::coroutines::protected_stack_allocator ().allocate (ctx, size);
+    coro.stack_ = ctx;
+}
+
+void
+JobQueue::Coro::StackAllocator::deallocate (
+    boost::coroutines::stack_context& ctx)
+{
+    boost::coroutines::protected_stack_allocator ().deallocate (ctx);
+}
+
+void
+JobQueue::Coro::releaseStack () const
+{
+#if ! BOOST_OS_WINDOWS
+    using traits = boost::coroutines::stack_traits;
+
+    if (! stack_.sp)
+        return;
+
+    // Keep the page holding this frame plus room for the frames of the
+    // release itself and the context switch that follows it.
+    std::uintptr_t const page = traits::page_size ();
+    std::uintptr_t const keep = 2 * page;
+
+    char const here = 0;
+    auto const top = reinterpret_cast<std::uintptr_t> (&here);
+    auto const bottom = reinterpret_cast<std::uintptr_t> (
+        static_cast<char const*> (stack_.sp) - stack_.size) + page;
+
+    if (top < bottom + keep + page)
+        return;
+
+    auto const end = (top - keep) & ~(page - 1);
+    if (end > bottom)
+        ::madvise (reinterpret_cast<void*> (bottom), end - bottom,
+            MADV_DONTNEED);
+#endif
+}
+
+//------------------------------------------------------------------------------
+
 JobQueue::JobQueue (beast::insight::Collector::ptr const& collector,
     Stoppable& parent, beast::Journal journal, Logs& logs,
     perf::PerfLog& perfLog)
@@ -52,6 +104,10 @@ JobQueue::JobQueue (beast::insight::Collector::ptr const& collector,
                 std::forward_as_tuple (jt, m_collector, logs)));
             assert (result.second == true);
             (void) result.second;
+
+            if (jt.type () >= 0 &&
+                    static_cast<std::size_t> (jt.type ()) >= m_jobQueues.size ())
+                m_jobQueues.resize (jt.type () + 1);
         }
     }
 }
@@ -66,7 +122,7 @@ void
 JobQueue::collect ()
 {
     std::lock_guard lock (m_mutex);
-    job_count = m_jobSet.size ();
+    job_count = m_jobCount;
 }
 
 bool
@@ -102,13 +158,14 @@ JobQueue::addRefCountedJob (JobType type, std::string const& name,
         //
         assert (! isStopped() && (
             m_processCount>0 ||
-            ! m_jobSet.empty () ||
+            m_jobCount != 0 ||
             ! areChildrenStopped()));
 
-        std::pair <std::set <Job>::iterator, bool> result (
-            m_jobSet.insert (Job (type, name, ++m_lastJob,
-                data.load (), func, m_cancelCallback)));
-        queueJob (*result.first, lock);
+        auto& queue = m_jobQueues[type];
+        queue.emplace_back (type, name, ++m_lastJob,
+            data.load (), func, m_cancelCallback);
+        ++m_jobCount;
+        queueJob (queue.back (), lock);
     }
     return true;
 }
@@ -280,7 +337,7 @@ JobQueue::rendezvous()
     cv_.wait(lock, [&]
     {
         return m_processCount == 0 &&
-            m_jobSet.empty();
+            m_jobCount == 0;
     });
 }
 
@@ -319,7 +376,7 @@ JobQueue::checkStopped (std::lock_guard <std::mutex> const& lock)
     if (isStopping() &&
         areChildrenStopped() &&
         (m_processCount == 0) &&
-        m_jobSet.empty() &&
+        (m_jobCount == 0) &&
         nSuspend_ == 0)
     {
         stopped();
@@ -331,7 +388,7 @@ JobQueue::queueJob (Job const& job, std::lock_guard <std::mutex> const& lock)
 {
     JobType const type (job.getType ());
     assert (type != jtINVALID);
-    assert (m_jobSet.find (job) != m_jobSet.end ());
+    assert (&m_jobQueues[type].back () == &job);
     perfLog_.jobQueue(type);
 
     JobTypeData& data (getJobTypeData (type));
@@ -352,12 +409,16 @@ JobQueue::queueJob (Job const& job, std::lock_guard <std::mutex> const& lock)
 void
 JobQueue::getNextJob (Job& job)
 {
-    assert (! m_jobSet.empty ());
+    assert (m_jobCount != 0);
 
-    std::set <Job>::const_iterator iter;
-    for (iter = m_jobSet.begin (); iter != m_jobSet.end (); ++iter)
+    // Higher job types have higher priority
+    for (auto type = m_jobQueues.size (); type-- != 0;)
     {
-        JobTypeData& data (getJobTypeData (iter->getType ()));
+        auto& queue = m_jobQueues[type];
+        if (queue.empty ())
+            continue;
+
+        JobTypeData& data (getJobTypeData (queue.front ().getType ()));
 
         assert (data.running <= getJobLimit (data.type ()));
 
@@ -365,22 +426,19 @@ JobQueue::getNextJob (Job& job)
         if (data.running < getJobLimit (data.type ()))
         {
             assert (data.waiting > 0);
-            break;
-        }
-    }
+            assert (data.type () != jtINVALID);
 
-    assert (iter != m_jobSet.end ());
+            job = std::move (queue.front ());
+            queue.pop_front ();
+            --m_jobCount;
 
-    JobType const type = iter->getType ();
-    JobTypeData& data (getJobTypeData (type));
-
-    assert (type != jtINVALID);
-
-    job = *iter;
-    m_jobSet.erase (iter);
+            --data.waiting;
+            ++data.running;
+            return;
+        }
+    }
 
-    --data.waiting;
-    ++data.running;
+    assert (false);
 }
 
 void
@@ -441,7 +499,7 @@ JobQueue::processTask (int instance)
         // otherwise destructors with side effects can access
         // parent objects that are already destroyed.
         finishJob (type);
-        if(--m_processCount == 0 && m_jobSet.empty())
+        if(--m_processCount == 0 && m_jobCount == 0)
             cv_.notify_all();
         checkStopped (lock);
     }
@@ -21,7 +21,9 @@
 #define RIPPLE_JSON_OUTPUT_H_INCLUDED
 
 #include <boost/beast/core/string.hpp>
+#include <cstddef>
 #include <functional>
+#include <string>
 
 namespace Json {
 
@@ -49,6 +51,50 @@ void outputJson (Json::Value const&, Output const&);
  */
 std::string jsonAsString (Json::Value const&);
 
+/** Coalesces small writes into larger chunks before passing them on.
+
+    Writer emits a JSON document as many tiny fragments (punctuation, keys,
+    scalars).  ChunkedOutput gathers those fragments and forwards them to
+    another Output whenever at least `chunkSize` bytes are pending, so that a
+    large document can be sent incrementally without either building it in
+    memory or issuing one write per token.
+
+    Call flush() once the document is complete; the destructor does not
+    flush, because the downstream Output may no longer be valid then.
+ */
+class ChunkedOutput
+{
+public:
+    ChunkedOutput (Output const& output, std::size_t chunkSize);
+
+    ChunkedOutput (ChunkedOutput const&) = delete;
+    ChunkedOutput& operator= (ChunkedOutput const&) = delete;
+
+    /** Return an Output that writes into this ChunkedOutput.
+
+        The returned Output refers to this object and must not outlive it.
+     */
+    Output output ();
+
+    /** Add bytes, forwarding a chunk if enough are pending. */
+    void write (boost::beast::string_view const&);
+
+    /** Forward any pending bytes, even if fewer than the chunk size. */
+    void flush ();
+
+    /** Return the total number of bytes written so far. */
+    std::size_t size () const
+    {
+        return size_;
+    }
+
+private:
+    Output const output_;
+    std::size_t const chunkSize_;
+    std::string buffer_;
+    std::size_t size_ = 0;
+};
+
 } // Json
 
 #endif
@@ -196,9 +196,8 @@ template <class Object>
 void doCopyFrom (Object& to, Json::Value const& from)
 {
     assert (from.isObjectOrNull());
-    auto members = from.getMemberNames();
-    for (auto& m: members)
-        to[m] = from[m];
+    for (auto it = from.begin(); it != from.end(); ++it)
+        to[it.memberName()] = *it;
 }
 
 }
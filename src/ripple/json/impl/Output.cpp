@@ -79,11 +79,10 @@ void outputJson (Json::Value const& value, Writer& writer)
     case Json::objectValue:
     {
         writer.startRoot (Writer::object);
-        auto members = value.getMemberNames ();
-        for (auto const& tag: members)
+        for (auto it = value.begin(); it != value.end(); ++it)
         {
-            writer.rawSet (tag);
-            outputJson (value[tag], writer);
+            writer.rawSet (it.memberName());
+            outputJson (*it, writer);
         }
         writer.finish();
         break;
@@ -107,4 +106,32 @@ std::string jsonAsString (Json::Value const& value)
     return s;
 }
 
+ChunkedOutput::ChunkedOutput (Output const& output, std::size_t chunkSize)
+    : output_ (output)
+    , chunkSize_ (chunkSize)
+{
+    buffer_.reserve (chunkSize_);
+}
+
+Output ChunkedOutput::output ()
+{
+    return [this](boost::beast::string_view const& b) { write (b); };
+}
+
+void ChunkedOutput::write (boost::beast::string_view const& bytes)
+{
+    size_ += bytes.size();
+    buffer_.append (bytes.data(), bytes.size());
+    if (buffer_.size() >= chunkSize_)
+        flush();
+}
+
+void ChunkedOutput::flush ()
+{
+    if (buffer_.empty())
+        return;
+    output_ (buffer_);
+    buffer_.clear();
+}
+
 } // Json
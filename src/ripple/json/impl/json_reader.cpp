@@ -20,8 +20,10 @@
 #include <ripple/basics/contract.h>
 #include <ripple/json/json_reader.h>
 #include <algorithm>
-#include <string>
 #include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <string>
 
 namespace Json
 {
@@ -68,6 +70,37 @@ codePointToUTF8 (unsigned int cp)
     return result;
 }
 
+// Return the first position in [first, last) holding a quote or a backslash.
+//
+// Strings make up most of the bytes in a typical request, so rather than
+// test one character at a time this checks eight bytes at once using the
+// "has a zero byte" trick on a word xor'ed with each character sought.
+static
+char const*
+findQuoteOrEscape (char const* first, char const* last)
+{
+    constexpr std::uint64_t ones = 0x0101010101010101ull;
+    constexpr std::uint64_t highs = 0x8080808080808080ull;
+    constexpr std::uint64_t quotes = ones * '"';
+    constexpr std::uint64_t escapes = ones * '\\';
+
+    while (last - first >= 8)
+    {
+        std::uint64_t word;
+        std::memcpy (&word, first, sizeof (word));
+        auto const q = word ^ quotes;
+        auto const e = word ^ escapes;
+        if ((((q - ones) & ~q) | ((e - ones) & ~e)) & highs)
+            break;
+        first += 8;
+    }
+
+    while (first != last && *first != '"' && *first != '\\')
+        ++first;
+
+    return first;
+}
+
 
 // Class Reader
 // //////////////////////////////////////////////////////////////////
@@ -407,19 +440,22 @@ Reader::readNumber ()
 bool
 Reader::readString ()
 {
-    Char c = 0;
-
     while ( current_ != end_ )
     {
-        c = getNextChar ();
+        current_ = findQuoteOrEscape ( current_, end_ );
 
-        if ( c == '\\' )
-            getNextChar ();
-        else if ( c == '"' )
+        if ( current_ == end_ )
             break;
+
+        if ( *current_++ == '"' )
+            return true;
+
+        // Skip the escaped character.
+        if ( current_ != end_ )
+            ++current_;
     }
 
-    return c == '"';
+    return false;
 }
 
 
@@ -461,10 +497,11 @@ Reader::readObject(Token& tokenStart, unsigned depth)
         }
 
         // Reject duplicate names
-        if (currentValue ().isMember (name))
+        auto const members = currentValue ().size ();
+        Value& value = currentValue ()[ name ];
+        if (currentValue ().size () == members)
             return addError ( "Key '" + name + "' appears twice.", tokenName );
 
-        Value& value = currentValue ()[ name ];
         nodes_.push ( &value );
         bool ok = readValue(depth+1);
         nodes_.pop ();
@@ -513,11 +550,9 @@ Reader::readArray(Token& tokenStart, unsigned depth)
         return true;
     }
 
-    int index = 0;
-
     while ( true )
     {
-        Value& value = currentValue ()[ index++ ];
+        Value& value = currentValue ().append ( Value () );
         nodes_.push ( &value );
         bool ok = readValue(depth+1);
         nodes_.pop ();
@@ -682,11 +717,19 @@ Reader::decodeString ( Token& token, std::string& decoded )
 
     while ( current != end )
     {
+        // Copy everything up to the next quote or escape in one go.
+        Location run = findQuoteOrEscape ( current, end );
+        decoded.append ( current, run );
+        current = run;
+
+        if ( current == end )
+            break;
+
         Char c = *current++;
 
         if ( c == '"' )
             break;
-        else if ( c == '\\' )
+        else
         {
             if ( current == end )
                 return addError ( "Empty escape sequence in string", token, current );
@@ -742,10 +785,6 @@ Reader::decodeString ( Token& token, std::string& decoded )
                 return addError ( "Bad escape sequence in string", token, current );
             }
         }
-        else
-        {
-            decoded += c;
-        }
     }
 
     return true;
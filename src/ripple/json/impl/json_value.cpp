@@ -22,6 +22,8 @@
 #include <ripple/json/to_string.h>
 #include <ripple/json/json_writer.h>
 #include <ripple/beast/core/LexicalCast.h>
+#include <tuple>
+#include <utility>
 
 namespace Json {
 
@@ -840,8 +842,7 @@ Value::operator[] ( UInt index )
     if ( it != value_.map_->end ()  &&  (*it).first == key )
         return (*it).second;
 
-    ObjectValues::value_type defaultValue ( key, null );
-    it = value_.map_->insert ( it, defaultValue );
+    it = value_.map_->emplace_hint ( it, key, null );
     return (*it).second;
 }
 
@@ -880,17 +881,19 @@ Value::resolveReference ( const char* key,
     if ( type_ == nullValue )
         *this = Value ( objectValue );
 
-    CZString actualKey ( key, isStatic ? CZString::noDuplication
-                         : CZString::duplicateOnCopy );
+    // Look the key up without copying it; only a newly inserted member
+    // needs its own copy of a non-static name.
+    CZString actualKey ( key, CZString::noDuplication );
     ObjectValues::iterator it = value_.map_->lower_bound ( actualKey );
 
     if ( it != value_.map_->end ()  &&  (*it).first == actualKey )
         return (*it).second;
 
-    ObjectValues::value_type defaultValue ( actualKey, null );
-    it = value_.map_->insert ( it, defaultValue );
-    Value& value = (*it).second;
-    return value;
+    it = value_.map_->emplace_hint ( it, std::piecewise_construct,
+        std::forward_as_tuple ( key, isStatic ? CZString::noDuplication
+                                : CZString::duplicate ),
+        std::forward_as_tuple () );
+    return (*it).second;
 }
 
 
@@ -951,7 +954,21 @@ Value::operator[] ( const StaticString& key )
 Value&
 Value::append ( const Value& value )
 {
-    return (*this)[size ()] = value;
+    return append ( Value ( value ) );
+}
+
+Value&
+Value::append ( Value&& value )
+{
+    JSON_ASSERT ( type_ == nullValue  ||  type_ == arrayValue );
+
+    if ( type_ == nullValue )
+        *this = Value ( arrayValue );
+
+    // The new index is past every existing one, so it always goes at the end.
+    auto it = value_.map_->emplace_hint ( value_.map_->end (),
+        CZString ( size () ), std::move ( value ) );
+    return (*it).second;
 }
 
 
@@ -239,21 +239,16 @@ FastWriter::writeValue ( const Value& value )
 
     case objectValue:
     {
-        Value::Members members ( value.getMemberNames () );
         document_ += "{";
 
-        for ( Value::Members::iterator it = members.begin ();
-                it != members.end ();
-                ++it )
+        for ( auto it = value.begin (); it != value.end (); ++it )
         {
-            std::string const& name = *it;
-
-            if ( it != members.begin () )
+            if ( it != value.begin () )
                 document_ += ",";
 
-            document_ += valueToQuotedString ( name.c_str () );
+            document_ += valueToQuotedString ( it.memberName () );
             document_ += ":";
-            writeValue ( value[name] );
+            writeValue ( *it );
         }
 
         document_ += "}";
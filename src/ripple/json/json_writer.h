@@ -234,17 +234,15 @@ write_value(Write const& write, Value const& value)
 
         case objectValue:
         {
-            Value::Members const members = value.getMemberNames();
             write("{", 1);
-            for (auto it = members.begin(); it != members.end(); ++it)
+            for (auto it = value.begin(); it != value.end(); ++it)
             {
-                std::string const& name = *it;
-                if (it != members.begin())
+                if (it != value.begin())
                     write(",", 1);
 
-                write_string(write, valueToQuotedString(name.c_str()));
+                write_string(write, valueToQuotedString(it.memberName()));
                 write(":", 1);
-                write_value(write, value[name]);
+                write_value(write, *it);
             }
             write("}", 1);
             break;
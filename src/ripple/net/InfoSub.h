@@ -26,7 +26,9 @@
 #include <ripple/resource/Consumer.h>
 #include <ripple/protocol/Book.h>
 #include <ripple/core/Stoppable.h>
+#include <memory>
 #include <mutex>
+#include <string>
 
 namespace ripple {
 
@@ -52,6 +54,38 @@ public:
 
     using Consumer = Resource::Consumer;
 
+    /** A published event, shared by every subscriber it is sent to.
+
+        The JSON text is rendered at most once, by the first subscriber
+        that asks for it, so a stream with many websocket clients does
+        not serialize the same event once per client.
+    */
+    class Event
+    {
+    public:
+        explicit Event (Json::Value jv);
+
+        Event (Event const&) = delete;
+        Event& operator= (Event const&) = delete;
+
+        Json::Value const&
+        json () const
+        {
+            return jv_;
+        }
+
+        /** The compact JSON serialization of the event. */
+        std::shared_ptr<std::string const> const&
+        text () const;
+
+    private:
+        Json::Value const jv_;
+        mutable std::once_flag once_;
+        mutable std::shared_ptr<std::string const> text_;
+    };
+
+    using EventPtr = std::shared_ptr<Event const>;
+
 public:
     /** Abstracts the source of subscription data.
     */
@@ -131,6 +165,13 @@ public:
 
     virtual void send (Json::Value const& jvObj, bool broadcast) = 0;
 
+    /** Send an event that is shared with other subscribers.
+
+        Subscribers that transmit JSON text should override this to
+        reuse the event's serialization.
+    */
+    virtual void send (EventPtr const& event, bool broadcast);
+
     std::uint64_t getSeq ();
 
     void onSendEmpty ();
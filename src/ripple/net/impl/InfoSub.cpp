@@ -18,6 +18,7 @@
 //==============================================================================
 
 #include <ripple/net/InfoSub.h>
+#include <ripple/json/json_writer.h>
 #include <atomic>
 
 namespace ripple {
@@ -42,6 +43,29 @@ InfoSub::Source::Source (char const* name, Stoppable& parent)
 
 //------------------------------------------------------------------------------
 
+InfoSub::Event::Event (Json::Value jv)
+    : jv_ (std::move (jv))
+{
+}
+
+std::shared_ptr<std::string const> const&
+InfoSub::Event::text () const
+{
+    std::call_once (once_, [this]
+        {
+            std::string s;
+            Json::stream (jv_,
+                [&s](void const* data, std::size_t n)
+                {
+                    s.append (static_cast<char const*> (data), n);
+                });
+            text_ = std::make_shared<std::string const> (std::move (s));
+        });
+    return text_;
+}
+
+//------------------------------------------------------------------------------
+
 InfoSub::InfoSub(Source& source)
     : m_source(source)
     , mSeq(assign_id())
@@ -77,6 +101,11 @@ InfoSub::~InfoSub ()
             (mSeq, normalSubscriptions_, false);
 }
 
+void InfoSub::send (EventPtr const& event, bool broadcast)
+{
+    send (event->json (), broadcast);
+}
+
 Resource::Consumer& InfoSub::getConsumer()
 {
     return m_consumer;
@@ -70,6 +70,8 @@ public:
 
     ~RPCSubImp() = default;
 
+    using InfoSub::send;
+
     void send (Json::Value const& jvObj, bool broadcast) override
     {
         std::lock_guard sl (mLock);
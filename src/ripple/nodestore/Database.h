@@ -245,10 +245,11 @@ protected:
     void
     importInternal(Backend& dstBackend, Database& srcDB);
 
+    // The negative cache may be null, misses are then not remembered
     std::shared_ptr<NodeObject>
     doFetch(uint256 const& hash, std::uint32_t seq,
         TaggedCache<uint256, NodeObject>& pCache,
-            KeyCache<uint256>& nCache, bool isAsync);
+            KeyCache<uint256>* nCache, bool isAsync);
 
     bool
     copyLedger(Backend& dstBackend, Ledger const& srcLedger,
@@ -183,7 +183,7 @@ Database::importInternal(Backend& dstBackend, Database& srcDB)
 std::shared_ptr<NodeObject>
 Database::doFetch(uint256 const& hash, std::uint32_t seq,
     TaggedCache<uint256, NodeObject>& pCache,
-        KeyCache<uint256>& nCache, bool isAsync)
+        KeyCache<uint256>* nCache, bool isAsync)
 {
     FetchReport report;
     report.isAsync = isAsync;
@@ -194,7 +194,7 @@ Database::doFetch(uint256 const& hash, std::uint32_t seq,
 
     // See if the object already exists in the cache
     auto nObj = pCache.fetch(hash);
-    if (! nObj && ! nCache.touch_if_exists(hash))
+    if (! nObj && ! (nCache && nCache->touch_if_exists(hash)))
     {
         // Try the database(s)
         report.wentToDisk = true;
@@ -204,9 +204,9 @@ Database::doFetch(uint256 const& hash, std::uint32_t seq,
         {
             // Just in case a write occurred
             nObj = pCache.fetch(hash);
-            if (! nObj)
+            if (! nObj && nCache)
                 // We give up
-                nCache.insert(hash);
+                nCache->insert(hash);
         }
         else
         {
@@ -385,8 +385,8 @@ Database::threadEntry()
         }
 
         // Perform the read
-        if (lastPcache && lastPcache)
-            doFetch(lastHash, lastSeq, *lastPcache, *lastNcache, true);
+        if (lastPcache)
+            doFetch(lastHash, lastSeq, *lastPcache, lastNcache.get(), true);
     }
 }
 
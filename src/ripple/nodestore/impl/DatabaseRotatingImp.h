@@ -84,7 +84,7 @@ public:
     std::shared_ptr<NodeObject>
     fetch(uint256 const& hash, std::uint32_t seq) override
     {
-        return doFetch(hash, seq, *pCache_, *nCache_, false);
+        return doFetch(hash, seq, *pCache_, nCache_.get(), false);
     }
 
     bool
@@ -32,6 +32,9 @@
 
 #include <boost/algorithm/string/predicate.hpp>
 
+#include <atomic>
+#include <thread>
+
 namespace ripple {
 namespace NodeStore {
 
@@ -147,6 +150,20 @@ DatabaseShardImp::init()
             return fail("'ledgers_per_shard' must be a multiple of 256");
     }
 
+    get_if_exists<std::uint32_t>(
+        section, "validate_threads", validateThreads_);
+
+    {
+        // A single cache bounds the memory used by all complete shards
+        auto sz {config.getSize(siNodeCacheSize)};
+        get_if_exists<int>(section, "cache_size", sz);
+        std::chrono::seconds::rep age {config.getSize(siNodeCacheAge)};
+        get_if_exists(section, "cache_age", age);
+
+        pCache_ = std::make_shared<PCache>("shard cache",
+            sz, std::chrono::seconds{age}, stopwatch(), j_);
+    }
+
     // NuDB is the default and only supported permanent storage backend
     // "Memory" and "none" types are supported for tests
     backendName_ = get<std::string>(section, "type", "nudb");
@@ -638,9 +655,51 @@ DatabaseShardImp::validate()
             completeShards.push_back(shard.second);
     }
 
-    // Verify each complete stored shard
-    for (auto const& shard : completeShards)
-        shard->validate();
+    // Verify the complete stored shards, several at a time. Each shard
+    // is checked against its own backend, independently of the others.
+    auto const start {std::chrono::steady_clock::now()};
+    std::size_t const total {completeShards.size()};
+    std::atomic<std::size_t> next {0};
+    std::atomic<std::size_t> valid {0};
+    auto worker = [&]()
+    {
+        for (auto i = next++; i < total; i = next++)
+        {
+            auto const& shard {completeShards[i]};
+            try
+            {
+                if (shard->validate())
+                    ++valid;
+            }
+            catch (std::exception const& e)
+            {
+                JLOG(j_.error()) <<
+                    "shard " << shard->index() <<
+                    " exception " << e.what() <<
+                    " in function " << __func__;
+            }
+        }
+    };
+
+    std::size_t threads {validateThreads_};
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    threads = std::min(threads, total);
+    {
+        std::vector<std::thread> pool;
+        pool.reserve(threads - 1);
+        for (std::size_t i = 1; i < threads; ++i)
+            pool.emplace_back(worker);
+        worker();
+        for (auto& t : pool)
+            t.join();
+    }
+
+    JLOG(j_.info()) <<
+        "validated " << total << " shards, " << valid << " valid, in " <<
+        std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::steady_clock::now() - start).count() <<
+        "s using " << threads << " threads";
 
     app_.shardFamily()->reset();
 }
@@ -879,7 +938,7 @@ DatabaseShardImp::fetch(uint256 const& hash, std::uint32_t seq)
 {
     auto cache {selectCache(seq)};
     if (cache.first)
-        return doFetch(hash, seq, *cache.first, *cache.second, false);
+        return doFetch(hash, seq, *cache.first, cache.second.get(), false);
     return {};
 }
 
@@ -892,7 +951,7 @@ DatabaseShardImp::asyncFetch(uint256 const& hash,
     {
         // See if the object is in cache
         object = cache.first->fetch(hash);
-        if (object || cache.second->touch_if_exists(hash))
+        if (object || (cache.second && cache.second->touch_if_exists(hash)))
             return true;
         // Otherwise post a read
         Database::asyncFetch(hash, seq, cache.first, cache.second);
@@ -944,9 +1003,8 @@ DatabaseShardImp::getDesiredAsyncReadCount(std::uint32_t seq)
         std::lock_guard lock(m_);
         assert(init_);
 
-        auto it = complete_.find(shardIndex);
-        if (it != complete_.end())
-            return it->second->pCache()->getTargetSize() / asyncDivider;
+        if (complete_.find(shardIndex) != complete_.end())
+            return pCache_->getTargetSize() / asyncDivider;
         if (incomplete_ && incomplete_->index() == shardIndex)
             return incomplete_->pCache()->getTargetSize() / asyncDivider;
     }
@@ -956,21 +1014,19 @@ DatabaseShardImp::getDesiredAsyncReadCount(std::uint32_t seq)
 float
 DatabaseShardImp::getCacheHitRate()
 {
-    float sz, f {0};
+    float sz {1}, f;
     {
         std::lock_guard lock(m_);
         assert(init_);
 
-        sz = complete_.size();
-        for (auto const& e : complete_)
-            f += e.second->pCache()->getHitRate();
+        f = pCache_->getHitRate();
         if (incomplete_)
         {
             f += incomplete_->pCache()->getHitRate();
             ++sz;
         }
     }
-    return f / std::max(1.0f, sz);
+    return f / sz;
 }
 
 void
@@ -979,9 +1035,7 @@ DatabaseShardImp::sweep()
     std::lock_guard lock(m_);
     assert(init_);
 
-    for (auto const& e : complete_)
-        e.second->sweep();
-
+    pCache_->sweep();
     if (incomplete_)
         incomplete_->sweep();
 }
@@ -1148,11 +1202,15 @@ DatabaseShardImp::selectCache(std::uint32_t seq)
         auto it = complete_.find(shardIndex);
         if (it != complete_.end())
         {
-            return std::make_pair(it->second->pCache(),
-                it->second->nCache());
+            // A complete shard has caches of its own only while validating
+            if (auto pCache = it->second->pCache())
+                return std::make_pair(pCache, it->second->nCache());
+            return std::make_pair(pCache_, std::shared_ptr<NCache>());
         }
     }
 
+    // The incomplete shard and import shards keep their own positive
+    // cache, a hit in the shared one does not mean their backend has it
     if (incomplete_ && incomplete_->index() == shardIndex)
     {
         return std::make_pair(incomplete_->pCache(),
@@ -211,6 +211,15 @@ private:
     // Average storage space required by a shard (in bytes)
     std::uint64_t avgShardFileSz_;
 
+    // Number of threads used to validate shards, zero for one per core
+    std::uint32_t validateThreads_ {0};
+
+    // Positive cache shared by every complete shard. Node objects are keyed
+    // by their content hash, so one bounded cache serves them all. The
+    // incomplete shard and import shards use their own, since a hit there
+    // must mean the object is in that shard's backend.
+    std::shared_ptr<PCache> pCache_;
+
     // File name used to mark shards being imported from node store
     static constexpr auto importMarker_ = "import";
 
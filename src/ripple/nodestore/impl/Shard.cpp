@@ -20,6 +20,7 @@
 #include <ripple/nodestore/impl/Shard.h>
 #include <ripple/app/ledger/InboundLedger.h>
 #include <ripple/app/main/DBInit.h>
+#include <ripple/basics/contract.h>
 #include <ripple/basics/StringUtilities.h>
 #include <ripple/core/ConfigSections.h>
 #include <ripple/nodestore/impl/DatabaseShardImp.h>
@@ -221,7 +222,8 @@ void
 Shard::sweep()
 {
     std::lock_guard lock(mutex_);
-    assert(pCache_ && nCache_);
+    if (!pCache_)
+        return;
 
     pCache_->sweep();
     nCache_->sweep();
@@ -249,8 +251,6 @@ std::shared_ptr<PCache>
 Shard::pCache() const
 {
     std::lock_guard lock(mutex_);
-    assert(pCache_);
-
     return pCache_;
 }
 
@@ -258,8 +258,6 @@ std::shared_ptr<NCache>
 Shard::nCache() const
 {
     std::lock_guard lock(mutex_);
-    assert(nCache_);
-
     return nCache_;
 }
 
@@ -291,7 +289,48 @@ Shard::lastStored() const
 }
 
 bool
-Shard::validate() const
+Shard::validate()
+{
+    // Read the shard through caches of its own, a hit in the cache shared
+    // by complete shards does not mean this shard's backend has the object
+    auto dropCache = [this]()
+    {
+        std::lock_guard lock(mutex_);
+        if (complete_)
+        {
+            pCache_.reset();
+            nCache_.reset();
+        }
+    };
+    {
+        std::lock_guard lock(mutex_);
+        if (!pCache_)
+        {
+            auto const name {"shard " + std::to_string(index_)};
+            auto const sz {Config::getSize(siNodeCacheSize, 0)};
+            auto const age {std::chrono::seconds{
+                Config::getSize(siNodeCacheAge, 0)}};
+            pCache_ = std::make_shared<PCache>(name, sz, age, stopwatch(), j_);
+            nCache_ = std::make_shared<NCache>(name, stopwatch(), sz, age);
+        }
+    }
+
+    bool valid {false};
+    try
+    {
+        valid = valShard();
+    }
+    catch (...)
+    {
+        dropCache();
+        Rethrow();
+    }
+    dropCache();
+    return valid;
+}
+
+bool
+Shard::valShard() const
 {
     uint256 hash;
     std::uint32_t seq {0};
@@ -376,12 +415,6 @@ Shard::validate() const
         next = ledger;
     }
 
-    {
-        std::lock_guard lock(mutex_);
-        pCache_->reset();
-        nCache_->reset();
-    }
-
     JLOG(j_.debug()) << "shard " << index_ << " is valid";
     return true;
 }
@@ -416,33 +449,24 @@ Shard::setComplete(std::lock_guard<std::mutex> const& lock)
 void
 Shard::setCache(std::lock_guard<std::mutex> const&)
 {
-    // complete shards use the smallest cache and
-    // fastest expiration to reduce memory consumption.
-    // The incomplete shard is set according to configuration.
-    if (!pCache_)
+    // Complete shards are served from the cache the shard store
+    // shares among them, so only the incomplete shard keeps its own.
+    // It is set according to configuration.
+    if (complete_)
+    {
+        pCache_.reset();
+        nCache_.reset();
+    }
+    else if (!pCache_)
     {
         auto const name {"shard " + std::to_string(index_)};
-        auto const sz {complete_ ?
-            Config::getSize(siNodeCacheSize, 0) :
-            app_.config().getSize(siNodeCacheSize)};
-        auto const age {std::chrono::seconds{complete_ ?
-            Config::getSize(siNodeCacheAge, 0) :
+        auto const sz {app_.config().getSize(siNodeCacheSize)};
+        auto const age {std::chrono::seconds{
             app_.config().getSize(siNodeCacheAge)}};
 
         pCache_ = std::make_shared<PCache>(name, sz, age, stopwatch(), j_);
         nCache_ = std::make_shared<NCache>(name, stopwatch(), sz, age);
     }
-    else
-    {
-        auto const sz {Config::getSize(siNodeCacheSize, 0)};
-        pCache_->setTargetSize(sz);
-        nCache_->setTargetSize(sz);
-
-        auto const age {std::chrono::seconds{
-            Config::getSize(siNodeCacheAge, 0)}};
-        pCache_->setTargetAge(age);
-        nCache_->setTargetAge(age);
-    }
 }
 
 bool
@@ -99,9 +99,11 @@ public:
     bool
     complete() const;
 
+    // Null for a complete shard unless it is being validated
     std::shared_ptr<PCache>
     pCache() const;
 
+    // Null for a complete shard unless it is being validated
     std::shared_ptr<NCache>
     nCache() const;
 
@@ -115,7 +117,7 @@ public:
     lastStored() const;
 
     bool
-    validate() const;
+    validate();
 
 private:
     static constexpr auto controlFileName = "control.txt";
@@ -137,10 +139,13 @@ private:
     // subsequent shards
     std::uint32_t const maxLedgers_;
 
-    // Database positive cache
+    // Database positive cache. Once the shard is complete the shard store
+    // serves it from a cache shared by all complete shards instead, and
+    // this one is only held while the shard is validated. Until then a
+    // hit must mean the object is in this shard's backend.
     std::shared_ptr<PCache> pCache_;
 
-    // Database negative cache
+    // Database negative cache, held alongside the positive cache
     std::shared_ptr<NCache> nCache_;
 
     // Path to database files
@@ -185,6 +190,10 @@ private:
     void
     setCache(std::lock_guard<std::mutex> const& lock);
 
+    // Validate every ledger stored in this shard
+    bool
+    valShard() const;
+
     // Open/Create SQLite databases
     // Lock over mutex_ required
     bool
@@ -398,12 +398,33 @@ public:
         return &v_[offset].get();
     }
 
-    int getFieldIndex (SField const& field) const;
+    int getFieldIndex (SField const& field) const
+    {
+        if (mType != nullptr)
+            return mType->getIndex (field);
+
+        int i = 0;
+        for (auto const& elem : v_)
+        {
+            if (elem->getFName () == field)
+                return i;
+            ++i;
+        }
+        return -1;
+    }
     SField const& getFieldSType (int index) const;
 
     const STBase& peekAtField (SField const& field) const;
     STBase& getField (SField const& field);
-    const STBase* peekAtPField (SField const& field) const;
+    const STBase* peekAtPField (SField const& field) const
+    {
+        int const index = getFieldIndex (field);
+
+        if (index == -1)
+            return nullptr;
+
+        return peekAtPIndex (index);
+    }
     STBase* getPField (SField const& field, bool createOkay = false);
 
     // these throw if the field type doesn't match, or return default values
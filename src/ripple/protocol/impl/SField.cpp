@@ -18,6 +18,7 @@
 //==============================================================================
 
 #include <ripple/protocol/SField.h>
+#include <array>
 #include <cassert>
 #include <string>
 #include <utility>
@@ -29,6 +30,31 @@ SField::IsSigning const SField::notSigning;
 int SField::num = 0;
 std::map<int, SField const*> SField::knownCodeToField;
 
+// Every field that can appear in a serialized object has a type and value
+// below these limits, so deserialization resolves codes with a single
+// index instead of searching knownCodeToField.  Zero initialized before
+// any SField is constructed.
+static constexpr int flatFieldTypes = 32;
+static constexpr int flatFieldValues = 256;
+static std::array<SField const*, flatFieldTypes * flatFieldValues>
+    flatCodeToField;
+
+static
+SField const**
+flatFieldSlot (int code)
+{
+    if (code < 0)
+        return nullptr;
+
+    int const type = code >> 16;
+    int const value = code & 0xffff;
+
+    if (type >= flatFieldTypes || value >= flatFieldValues)
+        return nullptr;
+
+    return &flatCodeToField[type * flatFieldValues + value];
+}
+
 // Give only this translation unit permission to construct SFields
 struct SField::private_access_tag_t
 {
@@ -251,6 +277,8 @@ SField::SField(private_access_tag_t,
     , jsonName (fieldName.c_str())
 {
     knownCodeToField[fieldCode] = this;
+    if (auto const slot = flatFieldSlot (fieldCode))
+        *slot = this;
 }
 
 SField::SField(private_access_tag_t, int fc)
@@ -263,11 +291,16 @@ SField::SField(private_access_tag_t, int fc)
     , jsonName (fieldName.c_str())
 {
     knownCodeToField[fieldCode] = this;
+    if (auto const slot = flatFieldSlot (fieldCode))
+        *slot = this;
 }
 
 SField const&
 SField::getField (int code)
 {
+    if (auto const slot = flatFieldSlot (code))
+        return *slot ? **slot : sfInvalid;
+
     auto it = knownCodeToField.find (code);
 
     if (it != knownCodeToField.end ())
@@ -29,6 +29,8 @@
 #include <boost/regex.hpp>
 #include <boost/algorithm/string.hpp>
 #include <boost/multiprecision/cpp_int.hpp>
+#include <algorithm>
+#include <array>
 #include <iterator>
 #include <memory>
 #include <iostream>
@@ -50,6 +52,59 @@ static const std::uint64_t tenTo14 = 100000000000000ull;
 static const std::uint64_t tenTo14m1 = tenTo14 - 1;
 static const std::uint64_t tenTo17 = tenTo14 * 1000;
 
+// Every power of ten that fits in 64 bits
+static constexpr std::array<std::uint64_t, 20> tenTo = []
+{
+    std::array<std::uint64_t, 20> powers {};
+    std::uint64_t p = 1;
+    for (auto& power : powers)
+    {
+        power = p;
+        p *= 10;
+    }
+    return powers;
+}();
+
+// The number of decimal digits in a value, which must not be zero
+static
+int
+digitCount (std::uint64_t value)
+{
+    assert (value != 0);
+#if defined(__GNUC__) || defined(__clang__)
+    // 1233 / 4096 approximates log10(2) closely enough that the guess is
+    // either the digit count or one less.
+    int const guess = ((64 - __builtin_clzll (value)) * 1233) >> 12;
+    return guess + (value >= tenTo[guess]);
+#else
+    return static_cast<int> (
+        std::upper_bound (tenTo.begin (), tenTo.end (), value) - tenTo.begin ());
+#endif
+}
+
+// Scale a native mantissa up into the range of an IOU mantissa, as when
+// the two are multiplied or divided together.
+static
+void
+scaleNative (std::uint64_t& value, int& offset)
+{
+    if (value < STAmount::cMinValue)
+    {
+        int const shift = 16 - digitCount (value);
+        value *= tenTo[shift];
+        offset -= shift;
+    }
+}
+
+// Divide a value by 10^shift, as dividing by ten shift times would.
+static
+std::uint64_t
+shiftDown (std::uint64_t value, int shift)
+{
+    return (shift < static_cast<int> (tenTo.size ())) ?
+        value / tenTo[shift] : 0;
+}
+
 //------------------------------------------------------------------------------
 static
 std::int64_t
@@ -656,16 +711,17 @@ void STAmount::canonicalize ()
             return;
         }
 
-        while (mOffset < 0)
+        if (mOffset < 0)
         {
-            mValue /= 10;
-            ++mOffset;
+            mValue = shiftDown (mValue, -mOffset);
+            mOffset = 0;
         }
 
         while (mOffset > 0)
         {
-            mValue *= 10;
-            --mOffset;
+            int const shift = std::min<int> (mOffset, tenTo.size () - 1);
+            mValue *= tenTo[shift];
+            mOffset -= shift;
         }
 
         if (mValue > cMaxNativeN)
@@ -683,19 +739,27 @@ void STAmount::canonicalize ()
         return;
     }
 
-    while ((mValue < cMinValue) && (mOffset > cMinOffset))
+    // Move the mantissa to sixteen digits in one step rather than one
+    // digit at a time. Scaling up stops at the smallest offset.
+    int const digits = digitCount (mValue);
+
+    if (digits < 16 && mOffset > cMinOffset)
     {
-        mValue *= 10;
-        --mOffset;
+        int const shift = std::min (16 - digits, mOffset - cMinOffset);
+        mValue *= tenTo[shift];
+        mOffset -= shift;
     }
-
-    while (mValue > cMaxValue)
+    else if (digits > 16)
     {
-        if (mOffset >= cMaxOffset)
+        int const shift = digits - 16;
+
+        // Removing the digits one at a time must not reach cMaxOffset
+        // before the last one.
+        if (mOffset + shift > cMaxOffset)
             Throw<std::runtime_error> ("value overflow");
 
-        mValue /= 10;
-        ++mOffset;
+        mValue /= tenTo[shift];
+        mOffset += shift;
     }
 
     if ((mOffset < cMinOffset) || (mValue < cMinValue))
@@ -997,9 +1061,14 @@ muldiv(
     std::uint64_t multiplicand,
     std::uint64_t divisor)
 {
+#ifdef __SIZEOF_INT128__
+    unsigned __int128 ret = multiplier;
+    ret *= multiplicand;
+#else
     boost::multiprecision::uint128_t ret;
 
     boost::multiprecision::multiply(ret, multiplier, multiplicand);
+#endif
     ret /= divisor;
 
     if (ret > std::numeric_limits<std::uint64_t>::max())
@@ -1021,9 +1090,14 @@ muldiv_round(
     std::uint64_t divisor,
     std::uint64_t rounding)
 {
+#ifdef __SIZEOF_INT128__
+    unsigned __int128 ret = multiplier;
+    ret *= multiplicand;
+#else
     boost::multiprecision::uint128_t ret;
 
     boost::multiprecision::multiply(ret, multiplier, multiplicand);
+#endif
     ret += rounding;
     ret /= divisor;
 
@@ -1054,23 +1128,10 @@ divide (STAmount const& num, STAmount const& den, Issue const& issue)
     int denOffset = den.exponent();
 
     if (num.native())
-    {
-        while (numVal < STAmount::cMinValue)
-        {
-            // Need to bring into range
-            numVal *= 10;
-            --numOffset;
-        }
-    }
+        scaleNative (numVal, numOffset);
 
     if (den.native())
-    {
-        while (denVal < STAmount::cMinValue)
-        {
-            denVal *= 10;
-            --denOffset;
-        }
-    }
+        scaleNative (denVal, denOffset);
 
     // We divide the two mantissas (each is between 10^15
     // and 10^16). To maintain precision, we multiply the
@@ -1111,22 +1172,10 @@ multiply (STAmount const& v1, STAmount const& v2, Issue const& issue)
     int offset2 = v2.exponent();
 
     if (v1.native())
-    {
-        while (value1 < STAmount::cMinValue)
-        {
-            value1 *= 10;
-            --offset1;
-        }
-    }
+        scaleNative (value1, offset1);
 
     if (v2.native())
-    {
-        while (value2 < STAmount::cMinValue)
-        {
-            value2 *= 10;
-            --offset2;
-        }
-    }
+        scaleNative (value2, offset2);
 
     // We multiply the two mantissas (each is between 10^15
     // and 10^16), so their product is in the 10^30 to 10^32
@@ -1146,27 +1195,22 @@ canonicalizeRound (bool native, std::uint64_t& value, int& offset)
     {
         if (offset < 0)
         {
-            int loops = 0;
-
-            while (offset < -1)
-            {
-                value /= 10;
-                ++offset;
-                ++loops;
-            }
+            int const loops = std::max (-offset - 1, 0);
+            value = shiftDown (value, loops);
 
             value += (loops >= 2) ? 9 : 10; // add before last divide
             value /= 10;
-            ++offset;
+            offset = 0;
         }
     }
     else if (value > STAmount::cMaxValue)
     {
-        while (value > (10 * STAmount::cMaxValue))
-        {
-            value /= 10;
-            ++offset;
-        }
+        // Leave seventeen digits, but no more than 10 * cMaxValue
+        int shift = std::max (digitCount (value) - 17, 0);
+        if (value / tenTo[shift] > (10 * STAmount::cMaxValue))
+            ++shift;
+        value /= tenTo[shift];
+        offset += shift;
 
         value += 9;     // add before last divide
         value /= 10;
@@ -1203,22 +1247,10 @@ mulRound (STAmount const& v1, STAmount const& v2, Issue const& issue,
     int offset1 = v1.exponent(), offset2 = v2.exponent();
 
     if (v1.native())
-    {
-        while (value1 < STAmount::cMinValue)
-        {
-            value1 *= 10;
-            --offset1;
-        }
-    }
+        scaleNative (value1, offset1);
 
     if (v2.native())
-    {
-        while (value2 < STAmount::cMinValue)
-        {
-            value2 *= 10;
-            --offset2;
-        }
-    }
+        scaleNative (value2, offset2);
 
     bool const resultNegative = v1.negative() != v2.negative();
 
@@ -1273,22 +1305,10 @@ divRound (STAmount const& num, STAmount const& den,
     int numOffset = num.exponent(), denOffset = den.exponent();
 
     if (num.native())
-    {
-        while (numVal < STAmount::cMinValue)
-        {
-            numVal *= 10;
-            --numOffset;
-        }
-    }
+        scaleNative (numVal, numOffset);
 
     if (den.native())
-    {
-        while (denVal < STAmount::cMinValue)
-        {
-            denVal *= 10;
-            --denOffset;
-        }
-    }
+        scaleNative (denVal, denOffset);
 
     bool const resultNegative =
         (num.negative() != den.negative());
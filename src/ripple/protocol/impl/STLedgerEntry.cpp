@@ -55,6 +55,22 @@ STLedgerEntry::STLedgerEntry (
     : STObject (sfLedgerEntry)
     , key_ (index)
 {
+    // The entry type canonically comes first. Knowing it up front lets
+    // the fields be read into storage sized once for the whole template.
+    if (sit.getBytesLeft () >= 3)
+    {
+        SerialIter peek (sit);
+        int type, field;
+        peek.getFieldID (type, field);
+        if (type == sfLedgerEntryType.fieldType &&
+            field == sfLedgerEntryType.fieldValue)
+        {
+            if (auto const format = LedgerFormats::getInstance ().findByType (
+                    safe_cast<LedgerEntryType> (peek.get16 ())))
+                reserve (format->getSOTemplate ().size ());
+        }
+    }
+
     set (sit);
     setSLEType ();
 }
@@ -112,22 +112,34 @@ void STObject::applyTemplate (const SOTemplate& type) noexcept (false)
     };
 
     mType = &type;
+
+    // Find where each template field sits in the object using the
+    // template's index rather than searching the object per field.
+    std::vector<int> pos (type.size(), -1);
+    SField const* disallowed = nullptr;
+    for (std::size_t i = 0; i < v_.size(); ++i)
+    {
+        auto const& name = v_[i]->getFName();
+        auto const index = name.getNum() > 0 ? type.getIndex (name) : -1;
+        if (index >= 0 && pos[index] < 0)
+            pos[index] = i;
+        else if (! disallowed && ! name.isDiscardable())
+            disallowed = &name;
+    }
+
     decltype(v_) v;
     v.reserve(type.size());
+    auto p = pos.cbegin();
     for (auto const& e : type)
     {
-        auto const iter = std::find_if(
-            v_.begin(), v_.end(), [&](detail::STVar const& b)
-                { return b.get().getFName() == e.sField(); });
-        if (iter != v_.end())
+        if (auto const i = *p++; i >= 0)
         {
-            if ((e.style() == soeDEFAULT) && iter->get().isDefault())
+            if ((e.style() == soeDEFAULT) && v_[i]->isDefault())
             {
                 throwFieldErr (e.sField().fieldName,
                     "may not be explicitly set to default.");
             }
-            v.emplace_back(std::move(*iter));
-            v_.erase(iter);
+            v.emplace_back(std::move(v_[i]));
         }
         else
         {
@@ -139,14 +151,11 @@ void STObject::applyTemplate (const SOTemplate& type) noexcept (false)
             v.emplace_back(detail::nonPresentObject, e.sField());
         }
     }
-    for (auto const& e : v_)
+    // Anything left over in the object must be discardable
+    if (disallowed)
     {
-        // Anything left over in the object must be discardable
-        if (! e->getFName().isDiscardable())
-        {
-            throwFieldErr (e->getFName().getName(),
-                "found in disallowed location.");
-        }
+        throwFieldErr (disallowed->getName(),
+            "found in disallowed location.");
     }
     // Swap the template matching data in for the old data,
     // freeing any leftover junk
@@ -166,6 +175,11 @@ bool STObject::set (SerialIter& sit, int depth) noexcept (false)
 {
     bool reachedEndOfObject = false;
 
+    // Canonically serialized objects list their fields in ascending
+    // field code order, which rules out duplicates without sorting.
+    bool ascending = true;
+    int lastCode = 0;
+
     v_.clear();
 
     // Consume data in the pipe until we run out or reach the end
@@ -205,6 +219,10 @@ bool STObject::set (SerialIter& sit, int depth) noexcept (false)
         // Unflatten the field
         v_.emplace_back(sit, fn, depth+1);
 
+        if (fn.fieldCode <= lastCode)
+            ascending = false;
+        lastCode = fn.fieldCode;
+
         // If the object type has a known SOTemplate then set it.
         if (auto const obj = dynamic_cast<STObject*>(&(v_.back().get())))
             obj->applyTemplateFromSField (fn);  // May throw
@@ -212,14 +230,17 @@ bool STObject::set (SerialIter& sit, int depth) noexcept (false)
 
     // We want to ensure that the deserialized object does not contain any
     // duplicate fields. This is a key invariant:
-    auto const sf = getSortedFields(*this, withAllFields);
+    if (! ascending)
+    {
+        auto const sf = getSortedFields(*this, withAllFields);
 
-    auto const dup = std::adjacent_find (sf.cbegin(), sf.cend(),
-        [] (STBase const* lhs, STBase const* rhs)
-        { return lhs->getFName() == rhs->getFName(); });
+        auto const dup = std::adjacent_find (sf.cbegin(), sf.cend(),
+            [] (STBase const* lhs, STBase const* rhs)
+            { return lhs->getFName() == rhs->getFName(); });
 
-    if (dup != sf.cend())
-        Throw<std::runtime_error> ("Duplicate field detected");
+        if (dup != sf.cend())
+            Throw<std::runtime_error> ("Duplicate field detected");
+    }
 
     return reachedEndOfObject;
 }
@@ -323,21 +344,6 @@ uint256 STObject::getSigningHash (std::uint32_t prefix) const
     return s.getSHA512Half ();
 }
 
-int STObject::getFieldIndex (SField const& field) const
-{
-    if (mType != nullptr)
-        return mType->getIndex (field);
-
-    int i = 0;
-    for (auto const& elem : v_)
-    {
-        if (elem->getFName () == field)
-            return i;
-        ++i;
-    }
-    return -1;
-}
-
 const STBase& STObject::peekAtField (SField const& field) const
 {
     int index = getFieldIndex (field);
@@ -364,16 +370,6 @@ STObject::getFieldSType (int index) const
     return v_[index]->getFName ();
 }
 
-const STBase* STObject::peekAtPField (SField const& field) const
-{
-    int index = getFieldIndex (field);
-
-    if (index == -1)
-        return nullptr;
-
-    return peekAtPIndex (index);
-}
-
 STBase* STObject::getPField (SField const& field, bool createOkay)
 {
     int index = getFieldIndex (field);
@@ -129,6 +129,8 @@ JSS ( auth_change_queued );         // out: AccountInfo
 JSS ( available );                  // out: ValidatorList
 JSS ( avg_bps_recv );               // out: Peers
 JSS ( avg_bps_sent );               // out: Peers
+JSS ( back_off_limit_hits );        // out: GetCounts
+JSS ( back_off_ms );                // out: GetCounts
 JSS ( balance );                    // out: AccountLines
 JSS ( balances );                   // out: GatewayBalances
 JSS ( base );                       // out: LogLevel
@@ -168,6 +170,8 @@ JSS ( complete_shards );            // out: OverlayImpl, PeerImp
 JSS ( consensus );                  // out: NetworkOPs, LedgerConsensus
 JSS ( converge_time );              // out: NetworkOPs
 JSS ( converge_time_s );            // out: NetworkOPs
+JSS ( copied_nodes );               // out: GetCounts
+JSS ( copy_ms );                    // out: GetCounts
 JSS ( count );                      // in: AccountTx*, ValidatorList
 JSS ( counters );                   // in/out: retrieve counters
 JSS ( currency );                   // in: paths/PathRequest, STAmount
@@ -369,6 +373,7 @@ JSS ( offer );                      // in: LedgerEntry
 JSS ( offers );                     // out: NetworkOPs, AccountOffers, Subscribe
 JSS ( offline );                    // in: TransactionSign
 JSS ( offset );                     // in/out: AccountTxOld
+JSS ( online_delete );              // out: GetCounts
 JSS ( open );                       // out: handlers/Ledger
 JSS ( open_ledger_fee );            // out: TxQ
 JSS ( open_ledger_level );          // out: TxQ
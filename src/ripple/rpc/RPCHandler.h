@@ -25,6 +25,10 @@
 #include <ripple/rpc/Context.h>
 #include <ripple/rpc/Status.h>
 
+namespace Json {
+class Object;
+}
+
 namespace ripple {
 namespace RPC {
 
@@ -33,6 +37,25 @@ struct Context;
 /** Execute an RPC command and store the results in a Json::Value. */
 Status doCommand (RPC::Context&, Json::Value&);
 
+/** Execute an RPC command and write the results to a Json::Object.
+
+    The handler writes its result incrementally, so a large response never
+    has to be held in memory as a complete Json::Value.  Only handlers for
+    which canStream() is true can be run this way.
+
+    If the handler throws, the exception is passed on to the caller, since
+    an error can't be added to a partly written object.
+*/
+Status doCommand (RPC::Context&, Json::Object&);
+
+/** Return true if the named method can write its result incrementally. */
+bool canStream (std::string const& method);
+
+/** Return a copy of a request with potentially sensitive fields masked,
+    suitable for echoing back in an error reply.
+*/
+Json::Value maskedRequest (Json::Value const& params);
+
 Role roleRequired (std::string const& method );
 
 } // RPC
@@ -22,6 +22,7 @@
 #include <ripple/app/ledger/LedgerMaster.h>
 #include <ripple/app/main/Application.h>
 #include <ripple/app/misc/NetworkOPs.h>
+#include <ripple/app/misc/SHAMapStore.h>
 #include <ripple/basics/UptimeClock.h>
 #include <ripple/core/DatabaseCon.h>
 #include <ripple/json/json_value.h>
@@ -119,6 +120,12 @@ Json::Value getCountsJson(Application& app, int minObjectCount)
     ret[jss::node_written_bytes] = app.getNodeStore().getStoreSize();
     ret[jss::node_read_bytes] = app.getNodeStore().getFetchSize();
 
+    {
+        auto jv = app.getSHAMapStore().getJson();
+        if (! jv.isNull())
+            ret[jss::online_delete] = std::move(jv);
+    }
+
     if (auto shardStore = app.getShardStore())
     {
         Json::Value& jv = (ret[jss::shards] = Json::objectValue);
@@ -90,7 +90,8 @@ void LedgerHandler::writeResult (Object& value)
     if (ledger_)
     {
         Json::copyFrom (value, result_);
-        addJson (value, {*ledger_, options_, queueTxs_, type_});
+        addJson (value, {*ledger_, options_, queueTxs_, type_,
+            &context_.app.getMasterTransaction ()});
     }
     else
     {
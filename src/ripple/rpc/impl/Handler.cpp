@@ -18,6 +18,7 @@
 //==============================================================================
 
 #include <ripple/rpc/impl/Handler.h>
+#include <ripple/json/Object.h>
 #include <ripple/rpc/handlers/Handlers.h>
 #include <ripple/rpc/handlers/Version.h>
 
@@ -175,6 +176,7 @@ class HandlerTable {
         Handler h;
         h.name_ = HandlerImpl::name();
         h.valueMethod_ = &handle<Json::Value, HandlerImpl>;
+        h.objectMethod_ = &handle<Json::Object, HandlerImpl>;
         h.role_ = HandlerImpl::role();
         h.condition_ = HandlerImpl::condition();
 
@@ -49,6 +49,9 @@ struct Handler
     Method<Json::Value> valueMethod_;
     Role role_;
     RPC::Condition condition_;
+
+    /** Writes the result incrementally; only set for new-style handlers. */
+    Method<Json::Object> objectMethod_;
 };
 
 Handler const* getHandler (std::string const&);
@@ -39,6 +39,7 @@
 #include <ripple/resource/Fees.h>
 #include <atomic>
 #include <chrono>
+#include <type_traits>
 
 namespace ripple {
 namespace RPC {
@@ -221,6 +222,11 @@ Status callMethod (
         if (context.loadType == Resource::feeReferenceRPC)
             context.loadType = Resource::feeExceptionRPC;
 
+        // A partly written Json::Object can't take an error any more, so
+        // leave the reply to the caller.
+        if constexpr (std::is_same_v<Object, Json::Object>)
+            Rethrow ();
+
         inject_error (rpcINTERNAL, result);
         return rpcINTERNAL;
     }
@@ -236,21 +242,7 @@ void getResult (
         JLOG (context.j.debug()) << "rpcError: " << status.toString();
         result[jss::status] = jss::error;
 
-        auto rq = context.params;
-
-        if (rq.isObject())
-        {
-            if (rq.isMember(jss::passphrase.c_str()))
-                rq[jss::passphrase.c_str()] = "<masked>";
-            if (rq.isMember(jss::secret.c_str()))
-                rq[jss::secret.c_str()] = "<masked>";
-            if (rq.isMember(jss::seed.c_str()))
-                rq[jss::seed.c_str()] = "<masked>";
-            if (rq.isMember(jss::seed_hex.c_str()))
-                rq[jss::seed_hex.c_str()] = "<masked>";
-        }
-
-        result[jss::request] = rq;
+        result[jss::request] = maskedRequest (context.params);
     }
     else
     {
@@ -296,6 +288,46 @@ Status doCommand (
     return rpcUNKNOWN_COMMAND;
 }
 
+Status doCommand (
+    RPC::Context& context, Json::Object& result)
+{
+    Handler const * handler = nullptr;
+    if (auto error = fillHandler (context, handler))
+    {
+        inject_error (error, result);
+        return error;
+    }
+
+    if (auto method = handler->objectMethod_)
+        return callMethod (context, method, handler->name_, result);
+
+    return rpcUNKNOWN_COMMAND;
+}
+
+bool canStream (std::string const& method)
+{
+    auto handler = RPC::getHandler (method);
+    return handler && handler->objectMethod_;
+}
+
+Json::Value maskedRequest (Json::Value const& params)
+{
+    auto rq = params;
+
+    if (rq.isObject())
+    {
+        if (rq.isMember(jss::passphrase.c_str()))
+            rq[jss::passphrase.c_str()] = "<masked>";
+        if (rq.isMember(jss::secret.c_str()))
+            rq[jss::secret.c_str()] = "<masked>";
+        if (rq.isMember(jss::seed.c_str()))
+            rq[jss::seed.c_str()] = "<masked>";
+        if (rq.isMember(jss::seed_hex.c_str()))
+            rq[jss::seed_hex.c_str()] = "<masked>";
+    }
+    return rq;
+}
+
 Role roleRequired (std::string const& method)
 {
     auto handler = RPC::getHandler(method);
@@ -32,6 +32,7 @@
 #include <ripple/basics/Log.h>
 #include <ripple/basics/make_SSLContext.h>
 #include <ripple/core/JobQueue.h>
+#include <ripple/json/Object.h>
 #include <ripple/json/to_string.h>
 #include <ripple/net/RPCErr.h>
 #include <ripple/overlay/Overlay.h>
@@ -48,6 +49,7 @@
 #include <boost/optional.hpp>
 #include <boost/regex.hpp>
 #include <algorithm>
+#include <exception>
 #include <stdexcept>
 
 namespace ripple {
@@ -347,11 +349,15 @@ ServerHandlerImp::onWSMessage(
         {
             auto const jr =
                 this->processSession(session, coro, jv);
-            auto const s = to_string(jr);
-            auto const n = s.length();
-            boost::beast::multi_buffer sb(n);
-            sb.commit(boost::asio::buffer_copy(
-                sb.prepare(n), boost::asio::buffer(s.c_str(), n)));
+            // Serialize straight into the message buffer rather than
+            // building an intermediate string and copying it.
+            boost::beast::multi_buffer sb;
+            Json::stream(jr,
+                [&sb](auto const p, auto const n)
+                {
+                    sb.commit(boost::asio::buffer_copy(
+                        sb.prepare(n), boost::asio::buffer(p, n)));
+                });
             session->send(std::make_shared<
                 StreambufWSMsg<decltype(sb)>>(std::move(sb)));
             session->complete();
@@ -473,22 +479,7 @@ ServerHandlerImp::processSession(
     {
         jr = jr[jss::result];
         jr[jss::status] = jss::error;
-
-        auto rq = jv;
-
-        if (rq.isObject())
-        {
-            if (rq.isMember(jss::passphrase.c_str()))
-                rq[jss::passphrase.c_str()] = "<masked>";
-            if (rq.isMember(jss::secret.c_str()))
-                rq[jss::secret.c_str()] = "<masked>";
-            if (rq.isMember(jss::seed.c_str()))
-                rq[jss::seed.c_str()] = "<masked>";
-            if (rq.isMember(jss::seed_hex.c_str()))
-                rq[jss::seed_hex.c_str()] = "<masked>";
-        }
-
-        jr[jss::request] = rq;
+        jr[jss::request] = RPC::maskedRequest(jv);
     }
     else
     {
@@ -523,7 +514,8 @@ ServerHandlerImp::processSession (std::shared_ptr<Session> const& session,
             if(iter != session->request().end())
                 return iter->value();
             return boost::beast::string_view{};
-        }());
+        }(),
+        session->request().version() >= 11 ? session.get() : nullptr);
 
     if(beast::rfc2616::is_keep_alive(session->request()))
         session->complete();
@@ -551,7 +543,8 @@ void
 ServerHandlerImp::processRequest (Port const& port,
     std::string const& request, beast::IP::Endpoint const& remoteIPAddress,
         Output&& output, std::shared_ptr<JobQueue::Coro> coro,
-        boost::string_view forwardedFor, boost::string_view user)
+        boost::string_view forwardedFor, boost::string_view user,
+        Session* chunkedSession)
 {
     auto rpcJ = app_.journal ("RPC");
 
@@ -781,6 +774,17 @@ ServerHandlerImp::processRequest (Port const& port,
         RPC::Context context {m_journal, params, app_, loadType, m_networkOPs,
             app_.getLedgerMaster(), usage, role, coro, InfoSub::pointer(),
             {user, forwardedFor}};
+
+        // A single request to a handler that can write its result as it
+        // goes is streamed, so that very large replies (for instance a full
+        // ledger) never need to be held in memory all at once.
+        if (chunkedSession && !batch && ripplerpc < "2.0" &&
+            RPC::canStream(strMethod))
+        {
+            processStreamed(context, usage, *chunkedSession, start);
+            return;
+        }
+
         Json::Value result;
         RPC::doCommand (context, result);
         usage.charge (loadType);
@@ -809,25 +813,12 @@ ServerHandlerImp::processRequest (Port const& port,
         }
         else
         {
-            // Always report "status".  On an error report the request as received.
+            // Always report "status".  On an error report the request as
+            // received, but mask potentially sensitive information.
             if (result.isMember (jss::error))
             {
-                auto rq = params;
-
-                if (rq.isObject())
-                { // But mask potentially sensitive information.
-                    if (rq.isMember(jss::passphrase.c_str()))
-                        rq[jss::passphrase.c_str()] = "<masked>";
-                    if (rq.isMember(jss::secret.c_str()))
-                        rq[jss::secret.c_str()] = "<masked>";
-                    if (rq.isMember(jss::seed.c_str()))
-                        rq[jss::seed.c_str()] = "<masked>";
-                    if (rq.isMember(jss::seed_hex.c_str()))
-                        rq[jss::seed_hex.c_str()] = "<masked>";
-                }
-
                 result[jss::status] = jss::error;
-                result[jss::request] = rq;
+                result[jss::request] = RPC::maskedRequest(params);
 
                 JLOG (m_journal.debug())  <<
                     "rpcError: " << result [jss::error] <<
@@ -873,6 +864,134 @@ ServerHandlerImp::processRequest (Port const& port,
     HTTPReply (200, response, output, rpcJ);
 }
 
+// Suspend the coroutine while the session has a lot of data queued, so a
+// slow client can't make us buffer a whole streamed reply.
+static
+void
+waitForDrain (Session& session, std::shared_ptr<JobQueue::Coro> const& coro)
+{
+    if (!coro)
+        return;
+
+    auto const waiting = session.onDrained (RPC::Tuning::streamQueueLimit,
+        [coro]
+        {
+            // If the post fails we are shutting down; finish on this
+            // thread so that the coroutine is not left suspended.
+            if (!coro->post())
+                coro->resume();
+        });
+    if (waiting)
+        coro->yield();
+}
+
+void
+ServerHandlerImp::processStreamed (RPC::Context& context,
+    Resource::Consumer& usage, Session& session,
+    std::chrono::high_resolution_clock::time_point start)
+{
+    auto const output = makeOutput (session);
+    auto const& params = context.params;
+
+    // The header goes out with the first chunk, so a handler that fails
+    // before filling one can still get an ordinary error reply.
+    bool started = false;
+    bool failed = false;
+    Json::ChunkedOutput chunked (
+        [&](boost::beast::string_view const& b)
+        {
+            // Drop what the writer emits while unwinding from a failure
+            if (failed || std::uncaught_exceptions () != 0)
+                return;
+            if (!started)
+            {
+                HTTPChunkedReply (output);
+                started = true;
+            }
+            HTTPChunk (b, output);
+            waitForDrain (session, context.coro);
+        },
+        RPC::Tuning::streamChunkSize);
+    {
+        Json::Writer writer (chunked.output());
+        Json::Object::Root root (writer);
+        try
+        {
+            auto&& result = Json::addObject (root, jss::result);
+            auto const status = RPC::doCommand (context, result);
+            usage.charge (context.loadType);
+            if (usage.warn())
+                result[jss::warning] = jss::load;
+
+            if (status)
+            {
+                JLOG (m_journal.debug()) << "rpcError: " << status.toString();
+                result[jss::status] = jss::error;
+                result[jss::request] = RPC::maskedRequest(params);
+            }
+            else
+            {
+                result[jss::status] = jss::success;
+            }
+        }
+        catch (std::exception const& e)
+        {
+            JLOG (m_journal.warn()) << "Streamed " <<
+                params[jss::command].asString() << " throws: " << e.what();
+            usage.charge (context.loadType);
+            failed = true;
+        }
+
+        if (!failed)
+        {
+            if (params.isMember(jss::jsonrpc))
+                root[jss::jsonrpc] = params[jss::jsonrpc];
+            if (params.isMember(jss::ripplerpc))
+                root[jss::ripplerpc] = params[jss::ripplerpc];
+            if (params.isMember(jss::id))
+                root[jss::id] = params[jss::id];
+        }
+    }
+
+    if (failed)
+    {
+        if (started)
+        {
+            // Part of the reply is already out. Drop the connection instead
+            // of ending the body, so the client can tell it is incomplete.
+            session.close (false);
+            return;
+        }
+
+        Json::Value result = rpcError (rpcINTERNAL);
+        result[jss::status] = jss::error;
+        result[jss::request] = RPC::maskedRequest(params);
+        Json::Value r (Json::objectValue);
+        r[jss::result] = std::move (result);
+        if (params.isMember(jss::jsonrpc))
+            r[jss::jsonrpc] = params[jss::jsonrpc];
+        if (params.isMember(jss::ripplerpc))
+            r[jss::ripplerpc] = params[jss::ripplerpc];
+        if (params.isMember(jss::id))
+            r[jss::id] = params[jss::id];
+        HTTPReply (200, to_string (r) + "\n", output, app_.journal ("RPC"));
+        return;
+    }
+
+    chunked.write ("\n");
+    chunked.flush ();
+    HTTPLastChunk (output);
+
+    rpc_time_.notify (
+        std::chrono::duration_cast <std::chrono::milliseconds> (
+            std::chrono::high_resolution_clock::now () - start));
+    ++rpc_requests_;
+    rpc_size_.notify (beast::insight::Event::value_type{chunked.size()});
+
+    JLOG (m_journal.debug()) << "Reply: streamed " << chunked.size() <<
+        " bytes for " << params[jss::command].asString();
+}
+
 //------------------------------------------------------------------------------
 
 /*  This response is used with load balancing.
@@ -29,6 +29,7 @@
 #include <ripple/app/main/CollectorManager.h>
 #include <ripple/json/Output.h>
 #include <boost/utility/string_view.hpp>
+#include <chrono>
 #include <map>
 #include <mutex>
 #include <vector>
@@ -181,7 +182,15 @@ private:
     processRequest (Port const& port, std::string const& request,
         beast::IP::Endpoint const& remoteIPAddress, Output&&,
         std::shared_ptr<JobQueue::Coro> coro,
-        boost::string_view forwardedFor, boost::string_view user);
+        boost::string_view forwardedFor, boost::string_view user,
+        Session* chunkedSession);
+
+    // Write the reply to a single request as it is generated, using
+    // chunked transfer encoding, instead of building it in memory first.
+    void
+    processStreamed (RPC::Context& context, Resource::Consumer& usage,
+        Session& session,
+        std::chrono::high_resolution_clock::time_point start);
 
     Handoff
     statusResponse(http_request_type const& request) const;
@@ -70,6 +70,13 @@ inline int pageLength(bool isBinary)
     return isBinary ? binaryPageLength : jsonPageLength;
 }
 
+/** Size of the chunks in which a streamed RPC reply is written. */
+static int const streamChunkSize = 64 * 1024;
+
+/** Bytes of a streamed RPC reply that may wait to be sent before the
+    handler is suspended until the client catches up. */
+static int const streamQueueLimit = 4 * streamChunkSize;
+
 /** Maximum number of source currencies allowed in a path find request. */
 static int const max_src_cur = 18;
 
@@ -83,6 +83,15 @@ public:
                 std::move(sb));
         sp->send(m);
     }
+
+    void
+    send(EventPtr const& event, bool) override
+    {
+        auto sp = ws_.lock();
+        if(! sp)
+            return;
+        sp->send(std::make_shared<SharedWSMsg>(event->text()));
+    }
 };
 
 } // ripple
@@ -105,6 +105,17 @@ public:
 
     /** @} */
 
+    /** Arrange to be told when pending writes have drained.
+
+        If more than `bytes` of the data passed to write() is still waiting
+        to be sent, `handler` will be called once no more than that remains
+        or the connection fails, and true is returned. Otherwise false is
+        returned and `handler` is not called.
+    */
+    virtual
+    bool
+    onDrained (std::size_t bytes, std::function<void()> handler) = 0;
+
     /** Detach the session.
         This holds the session open so that the response can be sent
         asynchronously. Calls to io_service::run made by the server
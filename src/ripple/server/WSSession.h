@@ -33,6 +33,7 @@
 #include <algorithm>
 #include <functional>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -109,6 +110,35 @@ public:
     }
 };
 
+/** A message whose bytes may be shared with other sessions. */
+class SharedWSMsg : public WSMsg
+{
+    std::shared_ptr<std::string const> s_;
+    std::size_t pos_ = 0;
+    std::size_t n_ = 0;
+
+public:
+    explicit
+    SharedWSMsg(std::shared_ptr<std::string const> s)
+        : s_(std::move(s))
+    {
+    }
+
+    std::pair<boost::tribool,
+        std::vector<boost::asio::const_buffer>>
+    prepare(std::size_t bytes,
+        std::function<void(void)>) override
+    {
+        pos_ += n_;
+        auto const remain = s_->size() - pos_;
+        if (remain == 0)
+            return{true, {}};
+        n_ = std::min(bytes, remain);
+        boost::tribool const done = n_ == remain;
+        return{done, {boost::asio::const_buffer(s_->data() + pos_, n_)}};
+    }
+};
+
 struct WSSession
 {
     std::shared_ptr<void> appDefined;
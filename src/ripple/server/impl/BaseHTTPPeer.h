@@ -97,6 +97,10 @@ protected:
     http_request_type message_;
     std::vector<buffer> wq_;
     std::vector<buffer> wq2_;
+    std::size_t queued_ = 0;
+    std::size_t drainBytes_ = 0;
+    std::function<void()> onDrained_;
+    bool failed_ = false;
     std::mutex mutex_;
     bool graceful_ = false;
     bool complete_ = false;
@@ -201,6 +205,9 @@ protected:
     write(std::shared_ptr <Writer> const& writer,
         bool keep_alive) override;
 
+    bool
+    onDrained(std::size_t bytes, std::function<void()> handler) override;
+
     std::shared_ptr<Session>
     detach() override;
 
@@ -279,6 +286,17 @@ fail(error_code ec, char const* what)
             std::string(what) << ": " << ec.message();
         impl().stream_.lowest_layer().close(ec);
     }
+
+    // Nothing more will be sent, so don't keep a writer waiting
+    std::function<void()> drained;
+    {
+        std::lock_guard lock(mutex_);
+        failed_ = true;
+        drained = std::move(onDrained_);
+        onDrained_ = nullptr;
+    }
+    if(drained)
+        drained();
 }
 
 template<class Handler, class Impl>
@@ -359,12 +377,22 @@ on_write(error_code const& ec,
     if(ec)
         return fail(ec, "write");
     bytes_out_ += bytes_transferred;
+    std::function<void()> drained;
     {
         std::lock_guard lock(mutex_);
+        for(auto const& b : wq2_)
+            queued_ -= b.bytes;
         wq2_.clear();
         wq2_.reserve(wq_.size());
         std::swap(wq2_, wq_);
+        if(onDrained_ && queued_ <= drainBytes_)
+        {
+            drained = std::move(onDrained_);
+            onDrained_ = nullptr;
+        }
     }
+    if(drained)
+        drained();
     if(! wq2_.empty())
     {
         std::vector<boost::asio::const_buffer> v;
@@ -446,7 +474,10 @@ write(
     if([&]
         {
             std::lock_guard lock(mutex_);
+            if(failed_)
+                return false;
             wq_.emplace_back(buf, bytes);
+            queued_ += bytes;
             return wq_.size() == 1 && wq2_.size() == 0;
         }())
     {
@@ -479,6 +510,19 @@ write(std::shared_ptr <Writer> const& writer,
             std::placeholders::_1)));
 }
 
+template<class Handler, class Impl>
+bool
+BaseHTTPPeer<Handler, Impl>::
+onDrained(std::size_t bytes, std::function<void()> handler)
+{
+    std::lock_guard lock(mutex_);
+    if(failed_ || queued_ <= bytes)
+        return false;
+    drainBytes_ = bytes;
+    onDrained_ = std::move(handler);
+    return true;
+}
+
 // DEPRECATED
 // Make the Session asynchronous
 template<class Handler, class Impl>
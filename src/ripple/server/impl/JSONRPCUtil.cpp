@@ -24,6 +24,7 @@
 #include <ripple/protocol/SystemParameters.h>
 #include <ripple/json/to_string.h>
 #include <boost/algorithm/string.hpp>
+#include <cstdio>
 
 namespace ripple {
 
@@ -117,4 +118,36 @@ void HTTPReply (
     output ("\r\n");
 }
 
+void HTTPChunkedReply (Json::Output const& output)
+{
+    output ("HTTP/1.1 200 OK\r\n");
+    output (getHTTPHeaderTimestamp ());
+    output ("Connection: Keep-Alive\r\n"
+            "Transfer-Encoding: chunked\r\n"
+            "Content-Type: application/json; charset=UTF-8\r\n");
+    output ("Server: " + systemName () + "-json-rpc/");
+    output (BuildInfo::getFullVersionString ());
+    output ("\r\n"
+            "\r\n");
+}
+
+void HTTPChunk (boost::beast::string_view const& data, Json::Output const& output)
+{
+    if (data.empty ())
+        return;
+
+    char size[2 * sizeof (std::size_t) + 3];
+    auto const n = std::snprintf (
+        size, sizeof (size), "%zx\r\n", data.size ());
+    output ({size, static_cast<std::size_t> (n)});
+    output (data);
+    output ("\r\n");
+}
+
+void HTTPLastChunk (Json::Output const& output)
+{
+    output ("0\r\n"
+            "\r\n");
+}
+
 } // ripple
@@ -28,6 +28,19 @@ namespace ripple {
 void HTTPReply (
     int nStatus, std::string const& strMsg, Json::Output const&, beast::Journal j);
 
+/** Write the header of a successful reply whose body is sent in chunks.
+
+    The body follows as any number of calls to HTTPChunk and must be
+    terminated by HTTPLastChunk.
+*/
+void HTTPChunkedReply (Json::Output const&);
+
+/** Write one chunk of a chunked reply body.  Empty chunks are ignored. */
+void HTTPChunk (boost::beast::string_view const& data, Json::Output const&);
+
+/** Write the final, empty chunk which ends a chunked reply body. */
+void HTTPLastChunk (Json::Output const&);
+
 } // ripple
 
 #endif
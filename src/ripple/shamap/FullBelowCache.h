@@ -22,8 +22,13 @@
 
 #include <ripple/basics/base_uint.h>
 #include <ripple/basics/KeyCache.h>
+#include <ripple/basics/Log.h>
 #include <ripple/beast/insight/Collector.h>
+#include <boost/filesystem.hpp>
 #include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <functional>
 #include <string>
 
 namespace ripple {
@@ -114,6 +119,102 @@ public:
         m_cache.insert (key);
     }
 
+    /** Return a snapshot of the keys in the cache.
+        Thread safety:
+            Safe to call from any thread.
+    */
+    std::vector <key_type> getKeys () const
+    {
+        return m_cache.getKeys ();
+    }
+
+    /** Write the keys to a file so a restarted server need not walk
+        subtrees it already verified as complete.
+
+        @param file The file to write.
+        @param epoch Identifies the node store the keys were verified
+                     against. load() discards the keys unless it is the same.
+        @return `true` if the file was written.
+    */
+    bool save (boost::filesystem::path const& file,
+        std::string const& epoch) const
+    {
+        auto const keys = getKeys ();
+        std::ofstream ofs (file.string(), std::ios::binary | std::ios::trunc);
+        std::uint32_t const epochSize = epoch.size ();
+        ofs.write (reinterpret_cast<char const*>(&epochSize), sizeof epochSize);
+        ofs.write (epoch.data (), epochSize);
+        for (auto const& key : keys)
+            ofs.write (reinterpret_cast<char const*>(key.data ()), key.size ());
+        return static_cast<bool>(ofs);
+    }
+
+    /** Insert the keys written by save().
+
+        The file is removed once read: it is only rewritten on a clean
+        shutdown, so keys from before a crash are never trusted. The keys
+        are discarded if the file was saved for another epoch, or if any
+        of a sample of them is not stored.
+
+        @param file The file to read.
+        @param epoch Identifies the node store in use now.
+        @param stored Returns whether the node store holds a key.
+        @param j Where to report discarded keys.
+        @return The number of keys inserted.
+    */
+    std::size_t load (boost::filesystem::path const& file,
+        std::string const& epoch,
+        std::function <bool (key_type const&)> const& stored,
+        beast::Journal j)
+    {
+        boost::system::error_code ec;
+        if (! boost::filesystem::exists (file, ec))
+            return 0;
+
+        std::string savedEpoch;
+        std::vector <key_type> keys;
+        {
+            std::ifstream ifs (file.string(), std::ios::binary);
+            std::uint32_t epochSize = 0;
+            if (ifs.read (reinterpret_cast<char*>(&epochSize),
+                    sizeof epochSize) && epochSize <= 4096)
+            {
+                savedEpoch.resize (epochSize);
+                if (ifs.read (&savedEpoch[0], epochSize))
+                {
+                    key_type key;
+                    while (ifs.read (
+                            reinterpret_cast<char*>(key.data ()), key.size ()))
+                        keys.push_back (key);
+                }
+            }
+        }
+        boost::filesystem::remove (file, ec);
+
+        if (savedEpoch != epoch)
+        {
+            JLOG (j.warn()) << "Discarding full below cache saved in " <<
+                file << " for node store " << savedEpoch;
+            return 0;
+        }
+
+        // The node store may have been replaced since the keys were saved
+        auto const step = std::max <std::size_t> (keys.size () / 16, 1);
+        for (std::size_t i = 0; i < keys.size (); i += step)
+        {
+            if (! stored (keys[i]))
+            {
+                JLOG (j.warn()) << "Discarding full below cache saved in " <<
+                    file << ", the node store lacks its keys";
+                return 0;
+            }
+        }
+
+        for (auto const& key : keys)
+            insert (key);
+        return keys.size ();
+    }
+
     /** generation determines whether cached entry is valid */
     std::uint32_t getGeneration (void) const
     {
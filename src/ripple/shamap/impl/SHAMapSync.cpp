@@ -473,7 +473,7 @@ bool SHAMap::getNodeFat (SHAMapNodeID wanted,
         Serializer s;
         node->addRaw (s, snfWIRE);
         nodeIDs.push_back (nodeID);
-        rawNodes.push_back (std::move (s.peekData()));
+        rawNodes.push_back (std::move (s.modData ()));
 
         if (node->isInner())
         {
@@ -505,7 +505,7 @@ bool SHAMap::getNodeFat (SHAMapNodeID wanted,
                             Serializer ns;
                             childNode->addRaw (ns, snfWIRE);
                             nodeIDs.push_back (childID);
-                            rawNodes.push_back (std::move (ns.peekData ()));
+                            rawNodes.push_back (std::move (ns.modData ()));
                         }
                     }
                 }
@@ -94,7 +94,7 @@ SHAMapAbstractNode::make(Slice const& rawNode, std::uint32_t seq, SHANodeFormat
             auto item = std::make_shared<SHAMapItem const>(
                 sha512Half(HashPrefix::transactionID,
                     Slice(s.data(), s.size())),
-                        s.peekData());
+                        std::move(s));
             if (hashValid)
                 return std::make_shared<SHAMapTreeNode>(item, tnTRANSACTION_NM, seq, hash);
             return std::make_shared<SHAMapTreeNode>(item, tnTRANSACTION_NM, seq);
@@ -111,7 +111,7 @@ SHAMapAbstractNode::make(Slice const& rawNode, std::uint32_t seq, SHANodeFormat
 
             if (u.isZero ()) Throw<std::runtime_error> ("invalid AS node");
 
-            auto item = std::make_shared<SHAMapItem const> (u, s.peekData ());
+            auto item = std::make_shared<SHAMapItem const> (u, std::move(s));
             if (hashValid)
                 return std::make_shared<SHAMapTreeNode>(item, tnACCOUNT_STATE, seq, hash);
             return std::make_shared<SHAMapTreeNode>(item, tnACCOUNT_STATE, seq);
@@ -170,7 +170,7 @@ SHAMapAbstractNode::make(Slice const& rawNode, std::uint32_t seq, SHANodeFormat
             if (u.isZero ())
                 Throw<std::runtime_error> ("invalid TM node");
 
-            auto item = std::make_shared<SHAMapItem const> (u, s.peekData ());
+            auto item = std::make_shared<SHAMapItem const> (u, std::move(s));
             if (hashValid)
                 return std::make_shared<SHAMapTreeNode>(item, tnTRANSACTION_MD, seq, hash);
             return std::make_shared<SHAMapTreeNode>(item, tnTRANSACTION_MD, seq);
@@ -198,7 +198,7 @@ SHAMapAbstractNode::make(Slice const& rawNode, std::uint32_t seq, SHANodeFormat
         {
             auto item = std::make_shared<SHAMapItem const>(
                 sha512Half(rawNode),
-                    s.peekData ());
+                    std::move(s));
             if (hashValid)
                 return std::make_shared<SHAMapTreeNode>(item, tnTRANSACTION_NM, seq, hash);
             return std::make_shared<SHAMapTreeNode>(item, tnTRANSACTION_NM, seq);
@@ -218,7 +218,7 @@ SHAMapAbstractNode::make(Slice const& rawNode, std::uint32_t seq, SHANodeFormat
                 Throw<std::runtime_error> ("invalid PLN node");
             }
 
-            auto item = std::make_shared<SHAMapItem const> (u, s.peekData ());
+            auto item = std::make_shared<SHAMapItem const> (u, std::move(s));
             if (hashValid)
                 return std::make_shared<SHAMapTreeNode>(item, tnACCOUNT_STATE, seq, hash);
             return std::make_shared<SHAMapTreeNode>(item, tnACCOUNT_STATE, seq);
@@ -255,7 +255,7 @@ SHAMapAbstractNode::make(Slice const& rawNode, std::uint32_t seq, SHANodeFormat
             uint256 txID;
             s.get256 (txID, s.getLength () - 32);
             s.chop (32);
-            auto item = std::make_shared<SHAMapItem const> (txID, s.peekData ());
+            auto item = std::make_shared<SHAMapItem const> (txID, std::move(s));
             if (hashValid)
                 return std::make_shared<SHAMapTreeNode>(item, tnTRANSACTION_MD, seq, hash);
             return std::make_shared<SHAMapTreeNode>(item, tnTRANSACTION_MD, seq);
@@ -349,6 +349,10 @@ SHAMapInnerNode::addRaw(Serializer& s, SHANodeFormat format) const
     {
         assert (!isEmpty ());
 
+        // Room for the prefix or trailing type byte and every hash, so
+        // the node is written without growing the buffer.
+        s.reserve (s.getDataLength () + 4 + 32 * mHashes.size ());
+
         if (format == snfPREFIX)
         {
             s.add32 (HashPrefix::innerNode);
@@ -394,8 +398,13 @@ SHAMapTreeNode::addRaw(Serializer& s, SHANodeFormat format) const
     if (format == snfHASH)
     {
         s.add256 (mHash.as_uint256());
+        return;
     }
-    else if (mType == tnACCOUNT_STATE)
+
+    // Room for the prefix or trailing type byte, the item and its key.
+    s.reserve (s.getDataLength () + 4 + mItem->size () + 32);
+
+    if (mType == tnACCOUNT_STATE)
     {
         if (format == snfPREFIX)
         {
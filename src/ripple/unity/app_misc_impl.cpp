@@ -18,6 +18,7 @@
 //==============================================================================
 
 
+#include <ripple/app/misc/impl/AccountSubscriptions.cpp>
 #include <ripple/app/misc/impl/AccountTxPaging.cpp>
 #include <ripple/app/misc/impl/AmendmentTable.cpp>
 #include <ripple/app/misc/impl/LoadFeeTrack.cpp>
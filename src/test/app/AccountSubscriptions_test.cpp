@@ -0,0 +1,97 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2019 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <ripple/app/misc/NetworkOPs.h>
+#include <ripple/app/misc/impl/AccountSubscriptions.h>
+#include <ripple/beast/unit_test.h>
+#include <test/jtx.h>
+
+namespace ripple {
+namespace test {
+
+class AccountSubscriptions_test : public beast::unit_test::suite
+{
+    class NullSub : public InfoSub
+    {
+    public:
+        explicit NullSub (Source& source)
+            : InfoSub (source)
+        {
+        }
+
+        using InfoSub::send;
+
+        void
+        send (Json::Value const&, bool) override
+        {
+        }
+    };
+
+public:
+    void
+    run () override
+    {
+        jtx::Env env (*this);
+        auto& source = env.app ().getOPs ();
+
+        AccountSubscriptions subs;
+        BEAST_EXPECT(subs.empty ());
+
+        AccountID const alice = jtx::Account ("alice").id ();
+        AccountID const bob = jtx::Account ("bob").id ();
+
+        auto const a = std::make_shared<NullSub> (source);
+        auto const b = std::make_shared<NullSub> (source);
+
+        subs.insert (alice, a);
+        subs.insert (alice, b);
+        subs.insert (bob, b);
+        BEAST_EXPECT(! subs.empty ());
+
+        {
+            // A snapshot is unaffected by later changes.
+            auto const snapshot = subs.find (alice);
+            BEAST_EXPECT(snapshot && snapshot->size () == 2);
+            subs.erase (alice, a->getSeq ());
+            BEAST_EXPECT(snapshot->size () == 2);
+            BEAST_EXPECT(subs.find (alice)->size () == 1);
+        }
+
+        hash_set<InfoSub::pointer> notify;
+        BEAST_EXPECT(subs.collect (alice, notify) == 1);
+        BEAST_EXPECT(subs.collect (bob, notify) == 1);
+        BEAST_EXPECT(notify.size () == 1);
+        BEAST_EXPECT(notify.count (b) == 1);
+
+        // Erasing an unknown listener is harmless.
+        subs.erase (bob, a->getSeq ());
+        BEAST_EXPECT(subs.find (bob)->size () == 1);
+
+        subs.erase (alice, b->getSeq ());
+        subs.erase (bob, b->getSeq ());
+        BEAST_EXPECT(subs.empty ());
+        BEAST_EXPECT(! subs.find (alice));
+        BEAST_EXPECT(subs.collect (bob, notify) == 0);
+    }
+};
+
+BEAST_DEFINE_TESTSUITE(AccountSubscriptions, app, ripple);
+
+} // test
+} // ripple
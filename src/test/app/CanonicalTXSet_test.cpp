@@ -0,0 +1,234 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2019 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <ripple/app/misc/CanonicalTXSet.h>
+#include <ripple/beast/unit_test.h>
+#include <ripple/beast/xor_shift_engine.h>
+#include <ripple/protocol/STAmount.h>
+#include <algorithm>
+#include <cstring>
+#include <set>
+#include <tuple>
+#include <vector>
+
+namespace ripple {
+namespace test {
+
+class CanonicalTXSet_test : public beast::unit_test::suite
+{
+    using Txs = std::vector<std::shared_ptr<STTx const>>;
+
+    static
+    std::shared_ptr<STTx const>
+    makeTx (AccountID const& account, std::uint32_t seq, std::uint64_t fee)
+    {
+        return std::make_shared<STTx const> (ttACCOUNT_SET,
+            [&](STObject& obj)
+            {
+                obj.setAccountID (sfAccount, account);
+                obj.setFieldU32 (sfSequence, seq);
+                obj.setFieldAmount (sfFee, STAmount (fee));
+            });
+    }
+
+    // The order transactions must come out in, computed the long way
+    static
+    auto
+    canonicalKey (uint256 const& salt, STTx const& tx)
+    {
+        uint256 account = beast::zero;
+        auto const id = tx.getAccountID (sfAccount);
+        std::memcpy (account.begin (), id.begin (), id.size ());
+        account ^= salt;
+        return std::make_tuple (
+            account, tx.getSequence (), tx.getTransactionID ());
+    }
+
+    bool
+    isCanonical (CanonicalTXSet const& set)
+    {
+        std::size_t count = 0;
+        boost::optional<decltype (canonicalKey (set.key (),
+            std::declval<STTx const&> ()))> prev;
+        for (auto const& [key, tx] : set)
+        {
+            if (! tx || key.getTXID () != tx->getTransactionID ())
+                return false;
+            auto const k = canonicalKey (set.key (), *tx);
+            if (prev && ! (*prev < k))
+                return false;
+            prev = k;
+            ++count;
+        }
+        return count == set.size ();
+    }
+
+    Txs
+    makeTxs (beast::xor_shift_engine& engine)
+    {
+        std::vector<AccountID> accounts;
+        for (int i = 0; i < 40; ++i)
+        {
+            AccountID a;
+            for (auto& b : a)
+                b = static_cast<std::uint8_t> (engine ());
+            accounts.push_back (a);
+        }
+
+        Txs txs;
+        std::uint64_t fee = 10;
+        for (auto const& a : accounts)
+            for (std::uint32_t seq = 1; seq < 6; ++seq)
+                for (int alt = 0; alt < 3; ++alt)
+                    txs.push_back (makeTx (a, seq, ++fee));
+        return txs;
+    }
+
+    void
+    testOrdering ()
+    {
+        testcase ("ordering");
+
+        beast::xor_shift_engine engine (2718);
+        auto txs = makeTxs (engine);
+        std::shuffle (txs.begin (), txs.end (), engine);
+
+        uint256 salt;
+        salt.SetHex ("0123456789ABCDEF0123456789ABCDEF"
+            "0123456789ABCDEF0123456789ABCDEF");
+        CanonicalTXSet set (salt);
+        BEAST_EXPECT(set.empty ());
+
+        // Inserting a transaction again does not add it twice
+        for (auto const& tx : txs)
+            set.insert (tx);
+        for (std::size_t i = 0; i < txs.size (); i += 7)
+            set.insert (txs[i]);
+        BEAST_EXPECT(set.size () == txs.size ());
+        BEAST_EXPECT(isCanonical (set));
+
+        // Inserting after reading sorts the new transaction into place
+        auto const late = makeTx (AccountID {}, 3, 1);
+        set.insert (late);
+        BEAST_EXPECT(set.size () == txs.size () + 1);
+        BEAST_EXPECT(isCanonical (set));
+
+        set.reset (uint256 {});
+        BEAST_EXPECT(set.empty ());
+        BEAST_EXPECT(set.begin () == set.end ());
+    }
+
+    void
+    testErase ()
+    {
+        testcase ("erase");
+
+        beast::xor_shift_engine engine (31415);
+        auto const txs = makeTxs (engine);
+
+        CanonicalTXSet set (uint256 {});
+        for (auto const& tx : txs)
+            set.insert (tx);
+
+        // Drop every other transaction the way a retry pass does
+        std::set<uint256> erased;
+        bool drop = true;
+        for (auto it = set.begin (); it != set.end ();)
+        {
+            if (drop)
+            {
+                erased.insert (it->first.getTXID ());
+                it = set.erase (it);
+            }
+            else
+                ++it;
+            drop = ! drop;
+        }
+        BEAST_EXPECT(set.size () == txs.size () - erased.size ());
+        BEAST_EXPECT(isCanonical (set));
+        for (auto const& item : set)
+            BEAST_EXPECT(erased.count (item.first.getTXID ()) == 0);
+
+        // Erased transactions can come back
+        for (auto const& tx : txs)
+        {
+            if (erased.count (tx->getTransactionID ()))
+                set.insert (tx);
+        }
+        BEAST_EXPECT(set.size () == txs.size ());
+        BEAST_EXPECT(isCanonical (set));
+
+        // Erasing everything leaves an empty set
+        for (auto it = set.begin (); it != set.end ();)
+            it = set.erase (it);
+        BEAST_EXPECT(set.empty ());
+        BEAST_EXPECT(set.begin () == set.end ());
+    }
+
+    void
+    testPrune ()
+    {
+        testcase ("prune");
+
+        beast::xor_shift_engine engine (1618);
+        auto const txs = makeTxs (engine);
+
+        CanonicalTXSet set (uint256 {42});
+        for (auto const& tx : txs)
+            set.insert (tx);
+
+        auto const account = txs[4]->getAccountID (sfAccount);
+        auto const seq = txs[4]->getSequence ();
+
+        // One of the alternatives was already erased
+        for (auto it = set.begin (); it != set.end (); ++it)
+        {
+            if (it->first.getTXID () == txs[4]->getTransactionID ())
+            {
+                set.erase (it);
+                break;
+            }
+        }
+
+        auto const pruned = set.prune (account, seq);
+        BEAST_EXPECT(pruned.size () == 2);
+        for (auto const& tx : pruned)
+        {
+            BEAST_EXPECT(tx->getAccountID (sfAccount) == account);
+            BEAST_EXPECT(tx->getSequence () == seq);
+        }
+        BEAST_EXPECT(set.size () == txs.size () - 3);
+        BEAST_EXPECT(isCanonical (set));
+        BEAST_EXPECT(set.prune (account, seq).empty ());
+    }
+
+public:
+    void
+    run () override
+    {
+        testOrdering ();
+        testErase ();
+        testPrune ();
+    }
+};
+
+BEAST_DEFINE_TESTSUITE(CanonicalTXSet, app, ripple);
+
+} // test
+} // ripple
@@ -18,16 +18,22 @@
 //==============================================================================
 
 #include <test/jtx.h>
+#include <test/jtx/CheckMessageLogs.h>
 #include <ripple/app/ledger/BuildLedger.h>
+#include <ripple/app/ledger/InboundLedgers.h>
 #include <ripple/app/ledger/LedgerMaster.h>
 #include <ripple/app/ledger/LedgerReplay.h>
+#include <ripple/app/misc/CanonicalTXSet.h>
+#include <ripple/core/JobQueue.h>
+#include <ripple/protocol/HashPrefix.h>
+#include <ripple/protocol/jss.h>
 
 namespace ripple {
 namespace test {
 
 struct LedgerReplay_test : public beast::unit_test::suite
 {
-    void run() override
+    void testReplay()
     {
         testcase("Replay ledger");
 
@@ -54,6 +60,244 @@ struct LedgerReplay_test : public beast::unit_test::suite
 
         BEAST_EXPECT(replayed->info().hash == lastClosed->info().hash);
     }
+
+    void testReplayRange()
+    {
+        testcase("Replay ledger range");
+
+        using namespace jtx;
+
+        auto const alice = Account("alice");
+        auto const bob = Account("bob");
+
+        Env env(*this);
+        env.fund(XRP(100000), alice, bob);
+        env.close();
+        auto const first = env.closed()->info().seq + 1;
+        for (int i = 0; i < 8; ++i)
+        {
+            env(pay(alice, bob, XRP(10 + i)));
+            env(pay(bob, alice, XRP(1)));
+            env.close();
+        }
+        auto const last = env.closed()->info().seq;
+
+        BEAST_EXPECT(replayLedgers(
+            first, last, env.app(), 3, env.journal) == 0);
+
+        // A ledger that is not stored fails to replay
+        BEAST_EXPECT(replayLedgers(
+            last, last + 1, env.app(), 1, env.journal) == 1);
+    }
+
+    // Build a ledger from a set of payments on a fresh server. If jobs is
+    // not zero, the signatures are first checked on that many jobs.
+    uint256
+    buildFromSet(std::size_t jobs)
+    {
+        using namespace jtx;
+
+        auto const alice = Account("alice");
+        auto const bob = Account("bob");
+
+        Env env(*this);
+        env.fund(XRP(100000), alice, bob);
+        env.close();
+
+        auto const parent = env.app().getLedgerMaster().getClosedLedger();
+        auto const aliceSeq = env.seq(alice);
+        CanonicalTXSet txns(parent->info().hash);
+        for (std::uint32_t i = 0; i < 100; ++i)
+            txns.insert(env.jt(pay(alice, bob, XRP(1 + i)),
+                seq(aliceSeq + i)).stx);
+
+        if (jobs)
+            checkSignatures(env.app(), parent->rules(), txns, jobs);
+
+        std::set<TxID> failed;
+        auto const built = buildLedger(parent,
+            parent->info().closeTime + parent->info().closeTimeResolution,
+            true, parent->info().closeTimeResolution, env.app(), txns,
+            failed, env.journal);
+        BEAST_EXPECT(txns.empty());
+        BEAST_EXPECT(failed.empty());
+        BEAST_EXPECT(std::distance(
+            built->txs.begin(), built->txs.end()) == 100);
+        return built->info().hash;
+    }
+
+    void testCheckSignatures()
+    {
+        testcase("Check signatures in parallel");
+
+        // Too few transactions for buildLedger to check them in
+        // parallel itself, so the first build is serial
+        auto const serial = buildFromSet(0);
+        BEAST_EXPECT(buildFromSet(3) == serial);
+        BEAST_EXPECT(buildFromSet(1) == serial);
+    }
+
+    // Close a few ledgers, each with a payment from alice
+    static std::vector<std::shared_ptr<Ledger const>>
+    makeHistory(jtx::Env& env)
+    {
+        using namespace jtx;
+
+        auto const alice = Account("alice");
+        auto const bob = Account("bob");
+        env.fund(XRP(100000), alice, bob);
+        env.close();
+
+        std::vector<std::shared_ptr<Ledger const>> history;
+        for (int i = 0; i < 3; ++i)
+        {
+            env(pay(alice, bob, XRP(10 + i)));
+            env.close();
+            history.push_back(env.app().getLedgerMaster().getClosedLedger());
+        }
+        return history;
+    }
+
+    // Store a ledger's header and transactions, but not its state
+    static void
+    storeWithoutState(Ledger const& ledger, Application& app)
+    {
+        auto& db = app.getNodeStore();
+        auto const seq = ledger.info().seq;
+
+        Serializer s(128);
+        s.add32(HashPrefix::ledgerMaster);
+        addRaw(ledger.info(), s);
+        db.store(hotLEDGER, std::move(s.modData()), ledger.info().hash, seq);
+
+        ledger.txMap().snapShot(false)->visitNodes(
+            [&](SHAMapAbstractNode& node)
+            {
+                Serializer n;
+                node.addRaw(n, snfPREFIX);
+                db.store(hotTRANSACTION_NODE, std::move(n.modData()),
+                    node.getNodeHash().as_uint256(), seq);
+                return true;
+            });
+    }
+
+    // Make a ledger whose nodes are in the node store available as
+    // a complete ledger
+    static std::shared_ptr<Ledger const>
+    holdLedger(LedgerInfo const& info, jtx::Env& env)
+    {
+        bool loaded = false;
+        auto ledger = std::make_shared<Ledger>(info, loaded, false,
+            env.app().config(), env.app().family(), env.journal);
+        if (!loaded)
+            return {};
+
+        auto& ledgerMaster = env.app().getLedgerMaster();
+        ledgerMaster.storeLedger(ledger);
+        ledgerMaster.setLedgerRangePresent(info.seq, info.seq);
+        return ledger;
+    }
+
+    static std::shared_ptr<InboundLedger>
+    acquire(Ledger const& ledger, jtx::Env& env)
+    {
+        auto const& info = ledger.info();
+        auto& inboundLedgers = env.app().getInboundLedgers();
+        inboundLedgers.acquire(
+            info.hash, info.seq, InboundLedger::Reason::GENERIC);
+        env.app().getJobQueue().rendezvous();
+        return inboundLedgers.find(info.hash);
+    }
+
+    void testInboundReplay()
+    {
+        testcase("Acquire ledger by replay");
+
+        using namespace jtx;
+
+        Env source(*this);
+        auto const history = makeHistory(source);
+        auto const& parent = history[1];
+        auto const& ledger = history[2];
+
+        // This server has the parent and the transactions, but none of
+        // the state of the ledger it acquires
+        bool rebuilt = false;
+        Env env(*this, envconfig(),
+            std::make_unique<CheckMessageLogs>("Rebuilt state of", rebuilt));
+        BEAST_EXPECT(env.app().getNodeStore().copyLedger(parent));
+        BEAST_EXPECT(holdLedger(parent->info(), env));
+        storeWithoutState(*ledger, env.app());
+
+        auto const inbound = acquire(*ledger, env);
+        BEAST_EXPECT(rebuilt);
+        if (!BEAST_EXPECT(inbound && inbound->isComplete()))
+            return;
+        BEAST_EXPECT(!inbound->isFailed());
+
+        auto const acquired = inbound->getLedger();
+        BEAST_EXPECT(acquired->info().hash == ledger->info().hash);
+        BEAST_EXPECT(acquired->info().accountHash ==
+            ledger->info().accountHash);
+
+        // The rebuilt state was written to the node store
+        BEAST_EXPECT(env.app().getNodeStore().fetch(
+            ledger->info().accountHash, ledger->info().seq));
+    }
+
+    void testInboundReplayMismatch()
+    {
+        testcase("Acquire ledger when replay does not match");
+
+        using namespace jtx;
+
+        Env source(*this);
+        auto const history = makeHistory(source);
+        auto const& stale = history[0];
+        auto const& parent = history[1];
+        auto const& ledger = history[2];
+
+        // Hold the parent under its own hash, but with the state of the
+        // ledger before it, so replaying on top of it goes wrong
+        bool mismatch = false;
+        Env env(*this, envconfig(),
+            std::make_unique<CheckMessageLogs>(
+                "does not match, fetching state", mismatch));
+        BEAST_EXPECT(env.app().getNodeStore().copyLedger(stale));
+        BEAST_EXPECT(env.app().getNodeStore().copyLedger(parent));
+        auto info = parent->info();
+        info.accountHash = stale->info().accountHash;
+        BEAST_EXPECT(holdLedger(info, env));
+        storeWithoutState(*ledger, env.app());
+
+        auto const inbound = acquire(*ledger, env);
+        BEAST_EXPECT(mismatch);
+        if (!BEAST_EXPECT(inbound))
+            return;
+        BEAST_EXPECT(!inbound->isComplete());
+        BEAST_EXPECT(!inbound->isFailed());
+        BEAST_EXPECT(!inbound->getJson(0)[jss::have_state].asBool());
+
+        // The acquisition fell back to the state nodes: once they are
+        // available it completes with the real ledger
+        BEAST_EXPECT(env.app().getNodeStore().copyLedger(ledger));
+        inbound->checkLocal();
+        env.app().getJobQueue().rendezvous();
+        if (!BEAST_EXPECT(inbound->isComplete()))
+            return;
+        BEAST_EXPECT(!inbound->isFailed());
+        BEAST_EXPECT(inbound->getLedger()->info().hash ==
+            ledger->info().hash);
+    }
+
+    void run() override
+    {
+        testReplay();
+        testReplayRange();
+        testCheckSignatures();
+        testInboundReplay();
+        testInboundReplayMismatch();
+    }
 };
 
 BEAST_DEFINE_TESTSUITE(LedgerReplay,app,ripple);
@@ -343,6 +343,16 @@ public:
         ledgerCheck(env, ledgerSeq - lastRotated, lastRotated);
         BEAST_EXPECT(lastRotated != store.getLastRotated());
 
+        {
+            // The rotation is reported by get_counts
+            auto const counts = env.rpc("get_counts")[jss::result];
+            BEAST_EXPECT(counts.isMember(jss::online_delete));
+            auto const& od = counts[jss::online_delete];
+            BEAST_EXPECT(od[jss::copied_nodes].asString() != "0");
+            BEAST_EXPECT(od.isMember(jss::copy_ms));
+            BEAST_EXPECT(od[jss::back_off_limit_hits].asUInt() == 0);
+        }
+
         lastRotated = store.getLastRotated();
 
         // Close enough ledgers to trigger another rotate
@@ -0,0 +1,130 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2019 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <ripple/app/ledger/TransactionMaster.h>
+#include <ripple/app/misc/Transaction.h>
+#include <ripple/protocol/jss.h>
+#include <test/jtx.h>
+
+namespace ripple {
+namespace test {
+
+class TransactionMaster_test : public beast::unit_test::suite
+{
+    void
+    testJsonCache ()
+    {
+        testcase ("json cache");
+
+        using namespace jtx;
+        Env env (*this);
+        Account const alice ("alice");
+        env.fund (XRP (10000), alice);
+        env (pay (env.master, alice, XRP (100)));
+        env.close ();
+
+        auto const stx = env.tx ();
+        BEAST_EXPECT(stx);
+        if (! stx)
+            return;
+
+        auto& master = env.app ().getMasterTransaction ();
+        auto const expected = stx->getJson (JsonOptions::none);
+
+        // The first call renders, the second is served from the cache
+        BEAST_EXPECT(master.getJson (*stx) == expected);
+        auto copy = master.getJson (*stx);
+        BEAST_EXPECT(copy == expected);
+
+        // Per-request fields go on the caller's copy only
+        copy[jss::date] = 12345;
+        copy[jss::ledger_index] = 3;
+        copy[jss::owner_funds] = "100";
+        BEAST_EXPECT(master.getJson (*stx) == expected);
+        BEAST_EXPECT(! master.getJson (*stx).isMember (jss::owner_funds));
+
+        // The same holds for fields Transaction adds from its own state
+        std::string reason;
+        auto const txn = std::make_shared<Transaction> (
+            stx, reason, env.app ());
+        txn->setStatus (COMMITTED, env.closed ()->info ().seq);
+        auto const withLedger = txn->getJson (JsonOptions::include_date);
+        BEAST_EXPECT(withLedger[jss::ledger_index] ==
+            env.closed ()->info ().seq);
+        BEAST_EXPECT(withLedger[jss::hash] == expected[jss::hash]);
+        BEAST_EXPECT(master.getJson (*stx) == expected);
+        BEAST_EXPECT(! master.getJson (*stx).isMember (jss::ledger_index));
+        BEAST_EXPECT(! master.getJson (*stx).isMember (jss::date));
+    }
+
+    void
+    testLedgerJson ()
+    {
+        testcase ("ledger json");
+
+        using namespace jtx;
+        Env env (*this);
+        Account const alice ("alice");
+        env.fund (XRP (10000), alice);
+        env (pay (env.master, alice, XRP (100)));
+        env.close ();
+
+        auto const stx = env.tx ();
+        BEAST_EXPECT(stx);
+        if (! stx)
+            return;
+
+        auto& master = env.app ().getMasterTransaction ();
+        auto const expected = stx->getJson (JsonOptions::none);
+
+        // An expanded ledger renders its transactions through the cache,
+        // and its metadata does not leak into the cached entry.
+        Json::Value params;
+        params[jss::ledger_index] = env.closed ()->info ().seq;
+        params[jss::transactions] = true;
+        params[jss::expand] = true;
+        for (int i = 0; i < 2; ++i)
+        {
+            auto const jrr = env.rpc ("json", "ledger",
+                to_string (params))[jss::result];
+            auto const& txs = jrr[jss::ledger][jss::transactions];
+            if (! BEAST_EXPECT(txs.isArray () && txs.size () == 1))
+                return;
+
+            auto tx = txs[0u];
+            BEAST_EXPECT(tx.isMember (jss::metaData));
+            tx.removeMember (jss::metaData.c_str ());
+            BEAST_EXPECT(tx == expected);
+            BEAST_EXPECT(master.getJson (*stx) == expected);
+        }
+    }
+
+public:
+    void
+    run () override
+    {
+        testJsonCache ();
+        testLedgerJson ();
+    }
+};
+
+BEAST_DEFINE_TESTSUITE(TransactionMaster, app, ripple);
+
+} // test
+} // ripple
@@ -73,6 +73,7 @@ public:
             c.sweep ();
             BEAST_EXPECT(c.size () == 1);
             BEAST_EXPECT(c.exists ("two"));
+            BEAST_EXPECT(c.getKeys () == std::vector<Key>{"two"});
         }
 
         // Insert three items (1 over limit), sweep
@@ -18,6 +18,8 @@
 //==============================================================================
 #include <ripple/beast/unit_test.h>
 #include <ripple/consensus/LedgerTrie.h>
+#include <chrono>
+#include <map>
 #include <random>
 #include <test/csf/ledgers.h>
 #include <unordered_map>
@@ -641,6 +643,10 @@ class LedgerTrie_test : public beast::unit_test::suite
         std::uniform_int_distribution<> depthDist(0, depthConst - 1);
         std::uniform_int_distribution<> widthDist(0, width - 1);
         std::uniform_int_distribution<> flip(0, 1);
+
+        // Tip support we expect the trie to hold, used to check the
+        // remembered preferred ledger against a freshly built trie
+        std::map<std::string, std::uint32_t> support;
         for (std::uint32_t i = 0; i < iterations; ++i)
         {
             // pick a random ledger history
@@ -656,11 +662,37 @@ class LedgerTrie_test : public beast::unit_test::suite
 
             // 50-50 to add remove
             if (flip(gen) == 0)
+            {
                 t.insert(h[curr]);
-            else
-                t.remove(h[curr]);
+                ++support[curr];
+            }
+            else if (t.remove(h[curr]))
+            {
+                if (--support[curr] == 0)
+                    support.erase(curr);
+            }
             if (!BEAST_EXPECT(t.checkInvariants()))
                 return;
+
+            if (i % 100 == 0)
+            {
+                LedgerTrie<Ledger> fresh;
+                for (auto const& [hist, count] : support)
+                    fresh.insert(h[hist], count);
+
+                for (Ledger::Seq seq{0}; seq <= Ledger::Seq{depthConst + 1};
+                     ++seq)
+                {
+                    auto const expected = fresh.getPreferred(seq);
+                    for (int repeat = 0; repeat < 2; ++repeat)
+                    {
+                        auto const got = t.getPreferred(seq);
+                        BEAST_EXPECT(bool(got) == bool(expected));
+                        if (got && expected)
+                            BEAST_EXPECT(got->id == expected->id);
+                    }
+                }
+            }
         }
     }
 
@@ -677,6 +709,77 @@ class LedgerTrie_test : public beast::unit_test::suite
     }
 };
 
+class LedgerTrie_timing_test : public beast::unit_test::suite
+{
+public:
+    void
+    run() override
+    {
+        using namespace csf;
+        using namespace std::chrono;
+
+        // Thousands of validators move up a chain that forks every round,
+        // while the local node asks for the preferred ledger after every
+        // handful of validations, the way its timer and peers would.
+        std::uint32_t const validators = 5000;
+        std::uint32_t const rounds = 50;
+        std::uint32_t const forks = 4;
+        std::uint32_t const queriesPerBatch = 8;
+        std::uint32_t const batch = 50;
+
+        LedgerOracle oracle;
+        std::uint32_t nextTx = 0;
+        LedgerTrie<Ledger> t;
+        std::mt19937 gen{42};
+        std::uniform_int_distribution<std::uint32_t> pick(0, 9);
+
+        Ledger main{Ledger::MakeGenesis{}};
+        std::vector<Ledger> tips(validators, main);
+        for (auto const& tip : tips)
+            t.insert(tip);
+
+        std::size_t queries = 0;
+        nanoseconds inPreferred{0};
+        auto const start = steady_clock::now();
+        for (std::uint32_t r = 0; r < rounds; ++r)
+        {
+            std::vector<Ledger> next;
+            for (std::uint32_t f = 0; f <= forks; ++f)
+                next.push_back(oracle.accept(main, Tx{++nextTx}));
+            main = next[0];
+
+            for (std::uint32_t v = 0; v < validators; ++v)
+            {
+                // Most validators follow the main chain
+                auto const choice = pick(gen);
+                Ledger const& lgr = choice < forks ? next[1 + choice] : main;
+                t.remove(tips[v]);
+                t.insert(lgr);
+                tips[v] = lgr;
+
+                if (v % batch == 0)
+                {
+                    auto const qstart = steady_clock::now();
+                    for (std::uint32_t q = 0; q < queriesPerBatch; ++q)
+                        t.getPreferred(main.seq());
+                    inPreferred += steady_clock::now() - qstart;
+                    queries += queriesPerBatch;
+                }
+            }
+        }
+        auto const elapsed = steady_clock::now() - start;
+        BEAST_EXPECT(t.getPreferred(main.seq())->id == main.id());
+
+        log << validators << " validators, " << rounds << " rounds: "
+            << queries << " getPreferred calls took "
+            << duration_cast<microseconds>(inPreferred).count()
+            << " us of "
+            << duration_cast<microseconds>(elapsed).count() / 1000
+            << " ms total" << std::endl;
+    }
+};
+
 BEAST_DEFINE_TESTSUITE(LedgerTrie, consensus, ripple);
+BEAST_DEFINE_TESTSUITE_MANUAL(LedgerTrie_timing, consensus, ripple);
 }  // namespace test
 }  // namespace ripple
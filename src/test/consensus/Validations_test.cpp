@@ -23,7 +23,9 @@
 #include <ripple/consensus/Validations.h>
 #include <test/csf/Validation.h>
 
+#include <atomic>
 #include <memory>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <vector>
@@ -1080,6 +1082,86 @@ class Validations_test : public beast::unit_test::suite
         }
     }
 
+    void
+    testConcurrentReaders()
+    {
+        // Tallies for a ledger are read without the lock while a single
+        // writer adds validations. The test adaptor's mutex does nothing,
+        // so readers only ever see published snapshots.
+        testcase("Concurrent readers");
+        LedgerHistoryHelper h;
+        TestHarness harness(h.oracle);
+        Ledger ledgerA = h["a"];
+        Ledger ledgerAB = h["ab"];
+        std::uint32_t const baseFee = 10;
+
+        std::size_t const numTrusted = 64;
+        std::vector<Node> nodes;
+        for (std::size_t i = 0; i < 2 * numTrusted; ++i)
+        {
+            nodes.push_back(harness.makeNode());
+            if (i % 2)
+                nodes.back().untrust();
+            else
+                nodes.back().setLoadFee(baseFee + 1 + i);
+        }
+
+        std::atomic<bool> done{false};
+        std::atomic<std::size_t> inconsistent{0};
+
+        auto reader = [&]() {
+            std::size_t seen = 0;
+            while (!done)
+            {
+                std::size_t const count =
+                    harness.vals().numTrustedForLedger(ledgerA.id());
+                if (count < seen || count > numTrusted)
+                    ++inconsistent;
+                seen = count;
+
+                auto const trusted =
+                    harness.vals().getTrustedForLedger(ledgerA.id());
+                if (trusted.size() < seen || trusted.size() > numTrusted)
+                    ++inconsistent;
+                for (auto const& v : trusted)
+                {
+                    if (!v.trusted() || !v.full() ||
+                        v.ledgerID() != ledgerA.id())
+                        ++inconsistent;
+                }
+
+                for (auto const fee :
+                     harness.vals().fees(ledgerA.id(), baseFee))
+                {
+                    if (fee <= baseFee)
+                        ++inconsistent;
+                }
+            }
+        };
+
+        std::vector<std::thread> readers;
+        for (int i = 0; i < 3; ++i)
+            readers.emplace_back(reader);
+
+        for (auto const& node : nodes)
+            harness.add(node.validate(ledgerA));
+        for (auto const& node : nodes)
+            harness.add(node.validate(
+                ledgerAB, std::chrono::seconds{1}, std::chrono::seconds{1}));
+
+        done = true;
+        for (auto& t : readers)
+            t.join();
+
+        BEAST_EXPECT(inconsistent == 0);
+        BEAST_EXPECT(
+            harness.vals().numTrustedForLedger(ledgerA.id()) == numTrusted);
+        BEAST_EXPECT(
+            harness.vals().numTrustedForLedger(ledgerAB.id()) == numTrusted);
+        BEAST_EXPECT(
+            harness.vals().fees(ledgerAB.id(), baseFee).size() == numTrusted);
+    }
+
     void
     run() override
     {
@@ -1097,6 +1179,7 @@ class Validations_test : public beast::unit_test::suite
         testNumTrustedForLedger();
         testSeqEnforcer();
         testTrustChanged();
+        testConcurrentReaders();
     }
 };
 
@@ -19,6 +19,8 @@
 
 #include <ripple/core/JobQueue.h>
 #include <test/jtx.h>
+#include <algorithm>
+#include <array>
 #include <chrono>
 #include <condition_variable>
 #include <mutex>
@@ -169,12 +171,59 @@ public:
         BEAST_EXPECT(*lv == -1);
     }
 
+    // Uses a kilobyte of stack per level of recursion
+    static
+    int
+    deep(int depth)
+    {
+        volatile char buf[1024];
+        for (auto& b : buf)
+            b = static_cast<char>(depth);
+        int const r = depth > 1 ? deep(depth - 1) : 0;
+        return r + buf[depth % sizeof(buf)];
+    }
+
+    void
+    stack_release()
+    {
+        using namespace std::chrono_literals;
+        using namespace jtx;
+        Env env(*this);
+        auto& jq = env.app().getJobQueue();
+        jq.setThreadCount(0, false);
+        gate g;
+        std::shared_ptr<JobQueue::Coro> c;
+        bool intact = false;
+        jq.postCoro(jtCLIENT, "Coroutine-Test",
+            [&](auto const& cr)
+            {
+                std::array<int, 64> local;
+                local.fill(42);
+                c = cr;
+                // The stack used here is released while suspended
+                deep(256);
+                g.signal();
+                c->yield();
+                intact = std::all_of(local.begin(), local.end(),
+                    [](int v) { return v == 42; });
+                deep(256);
+                g.signal();
+            });
+        BEAST_EXPECT(g.wait_for(5s));
+        c->join();
+        c->post();
+        BEAST_EXPECT(g.wait_for(5s));
+        c->join();
+        BEAST_EXPECT(intact);
+    }
+
     void
     run() override
     {
         correct_order();
         incorrect_order();
         thread_specific_storage();
+        stack_release();
     }
 };
 
@@ -20,6 +20,11 @@
 #include <ripple/core/JobQueue.h>
 #include <ripple/beast/unit_test.h>
 #include <test/jtx/Env.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
 
 namespace ripple {
 namespace test {
@@ -139,15 +144,95 @@ class JobQueue_test : public beast::unit_test::suite
         }
     }
 
+    void testPriority()
+    {
+        jtx::Env env {*this};
+
+        JobQueue& jQueue = env.app().getJobQueue();
+
+        // Hold the only worker thread while the queue fills up.
+        std::mutex m;
+        std::condition_variable cv;
+        bool release = false;
+        bool blocked = false;
+        BEAST_EXPECT (jQueue.addJob (jtADMIN, "Blocker",
+            [&](Job&)
+            {
+                std::unique_lock<std::mutex> lock (m);
+                blocked = true;
+                cv.notify_all();
+                cv.wait (lock, [&]{ return release; });
+            }));
+        {
+            std::unique_lock<std::mutex> lock (m);
+            cv.wait (lock, [&]{ return blocked; });
+        }
+
+        std::vector<int> order;
+        auto add = [&](JobType type, int id)
+        {
+            BEAST_EXPECT (jQueue.addJob (type, "PriorityTest",
+                [&order, id](Job&) { order.push_back (id); }));
+        };
+        add (jtCLIENT, 4);
+        add (jtTRANSACTION, 2);
+        add (jtCLIENT, 5);
+        add (jtPACK, 6);
+        add (jtTRANSACTION, 3);
+        add (jtADMIN, 1);
+
+        {
+            std::lock_guard<std::mutex> lock (m);
+            release = true;
+        }
+        cv.notify_all();
+        jQueue.rendezvous();
+
+        // Higher priority types first, in order of arrival within a type.
+        BEAST_EXPECT (order == std::vector<int>({1, 2, 3, 4, 5, 6}));
+    }
+
 public:
     void run() override
     {
         testAddJob();
         testPostCoro();
+        testPriority();
+    }
+};
+
+class JobQueue_timing_test : public beast::unit_test::suite
+{
+public:
+    void run() override
+    {
+        using namespace std::chrono;
+
+        jtx::Env env {*this};
+        JobQueue& jQueue = env.app().getJobQueue();
+
+        JobType const types[] = {
+            jtCLIENT, jtRPC, jtTRANSACTION, jtLEDGER_DATA, jtPUBOLDLEDGER};
+        int const count = 2000000;
+        std::atomic<int> ran {0};
+
+        auto const start = steady_clock::now();
+        for (int i = 0; i < count; ++i)
+            jQueue.addJob (types[i % 5], "TimingTest",
+                [&ran](Job&) { ++ran; });
+        jQueue.rendezvous();
+        auto const elapsed = duration_cast<milliseconds> (
+            steady_clock::now() - start);
+
+        BEAST_EXPECT (ran == count);
+        log << "Ran " << count << " jobs in " << elapsed.count() << " ms, "
+            << (elapsed.count() * 1000000.0) / count << " ns per job"
+            << std::endl;
     }
 };
 
 BEAST_DEFINE_TESTSUITE(JobQueue, core, ripple);
+BEAST_DEFINE_TESTSUITE_MANUAL(JobQueue_timing, core, ripple);
 
 } // test
 } // ripple
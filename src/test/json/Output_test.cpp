@@ -45,8 +45,40 @@ struct Output_test : ripple::test::TestOutputSuite
         runTest (name, name);
     }
 
+    void testChunkedOutput ()
+    {
+        testcase ("chunked output");
+
+        std::vector<std::string> chunks;
+        Output const sink = [&](boost::beast::string_view const& b)
+        {
+            chunks.emplace_back (b.data(), b.size());
+        };
+
+        Json::Value value;
+        BEAST_EXPECT(Json::Reader().parse (
+            "{\"array\":[{\"12\":23},{},null,false,0.5],"
+            "\"hello\":\"world\"}", value));
+
+        ChunkedOutput chunked (sink, 8);
+        outputJson (value, chunked.output());
+        for (auto const& chunk : chunks)
+            BEAST_EXPECT(chunk.size() >= 8);
+        chunked.flush();
+        chunked.flush();
+
+        std::string joined;
+        for (auto const& chunk : chunks)
+            joined += chunk;
+        BEAST_EXPECT(joined == jsonAsString (value));
+        BEAST_EXPECT(chunked.size() == joined.size());
+        BEAST_EXPECT(chunks.size() > 1);
+    }
+
     void run () override
     {
+        testChunkedOutput ();
+
         runTest ("empty dict", "{}");
         runTest ("empty array", "[]");
         runTest ("array", "[23,4.25,true,null,\"string\"]");
@@ -0,0 +1,180 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2019 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <ripple/json/json_reader.h>
+#include <ripple/json/json_value.h>
+#include <ripple/json/to_string.h>
+#include <ripple/beast/unit_test.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace ripple {
+
+// A small corpus shaped like the requests the server parses most: a
+// multi-signed submit and a path_find with several source currencies.
+static
+std::vector<std::string>
+requestCorpus ()
+{
+    std::string const signer =
+        "{\"Signer\":{\"Account\":\"rPcNzota6B8YBokhYtcTNqQVCngtbnWfux\","
+        "\"SigningPubKey\":\"02691AC5AE1C4C333AE5DF8A93BDC495F0EEBFC6DB0DA7EB"
+        "6EF808F3AFC006E3FE\",\"TxnSignature\":\"3045022100A7CE8A9C3BA4F0F5"
+        "D6E1D8F8D1B1B6C4B5A1A9C0E3D8B3C1A2F6E5D4C3B2A1F0E9D80220123456789A"
+        "BCDEF0123456789ABCDEF0123456789ABCDEF0123456789ABCDEF\"}}";
+
+    std::string submit =
+        "{\"method\":\"submit_multisigned\",\"params\":[{\"tx_json\":{"
+        "\"Account\":\"rHb9CJAWyB4rj91VRWn96DkukG4bwdtyTh\","
+        "\"TransactionType\":\"Payment\",\"Fee\":\"30000\",\"Sequence\":4,"
+        "\"Destination\":\"rPMh7Pi9ct699iZUTWaytJUoHcJ7cgyziK\","
+        "\"Amount\":{\"currency\":\"USD\",\"value\":\"1.5\","
+        "\"issuer\":\"rvYAfWj5gh67oV6fW32ZzP3Aw4Eubs59B\"},"
+        "\"Memos\":[{\"Memo\":{\"MemoData\":\"72656e74\","
+        "\"MemoType\":\"687474703a2f2f6578616d706c652e636f6d2f\\u0041\"}}],"
+        "\"SigningPubKey\":\"\",\"Signers\":[";
+    for (int i = 0; i < 8; ++i)
+    {
+        if (i != 0)
+            submit += ',';
+        submit += signer;
+    }
+    submit += "]}}]}";
+
+    std::string pathFind =
+        "{\"method\":\"ripple_path_find\",\"params\":[{"
+        "\"source_account\":\"r9cZA1mLK5R5Am25ArfXFmqgNwjZgnfk59\","
+        "\"destination_account\":\"r9cZA1mLK5R5Am25ArfXFmqgNwjZgnfk59\","
+        "\"destination_amount\":{\"value\":\"-1\",\"currency\":\"USD\","
+        "\"issuer\":\"rvYAfWj5gh67oV6fW32ZzP3Aw4Eubs59B\"},"
+        "\"source_currencies\":[";
+    for (int i = 0; i < 18; ++i)
+    {
+        if (i != 0)
+            pathFind += ',';
+        pathFind += "{\"currency\":\"C" + std::to_string (10 + i) + "\","
+            "\"issuer\":\"rvYAfWj5gh67oV6fW32ZzP3Aw4Eubs59B\"}";
+    }
+    pathFind += "],\"ledger_index\":\"current\",\"id\":7}]}";
+
+    return {submit, pathFind};
+}
+
+class Reader_test : public beast::unit_test::suite
+{
+    void
+    testStrings ()
+    {
+        testcase ("strings");
+
+        // Quotes and escapes at every offset within an eight byte word.
+        for (std::size_t pad = 0; pad < 17; ++pad)
+        {
+            std::string const prefix (pad, 'x');
+            std::string const doc = "{\"" + prefix + "k\":\"" + prefix +
+                "a\\\"b\\\\c\\u00e9\\n" + prefix + "\"}";
+
+            Json::Value v;
+            BEAST_EXPECT(Json::Reader ().parse (doc, v));
+            BEAST_EXPECT(v[prefix + "k"].asString () ==
+                prefix + "a\"b\\c\xc3\xa9\n" + prefix);
+        }
+
+        Json::Value v;
+        BEAST_EXPECT(! Json::Reader ().parse ("{\"a\":\"unterminated}", v));
+        BEAST_EXPECT(! Json::Reader ().parse ("{\"a\":\"ends\\", v));
+        BEAST_EXPECT(! Json::Reader ().parse ("{\"a\":\"bad\\q\"}", v));
+    }
+
+    void
+    testStructure ()
+    {
+        testcase ("structure");
+
+        Json::Value v;
+        BEAST_EXPECT(Json::Reader ().parse (
+            "{\"a\":[1,[],{},\"s\",null,true,-2.5],\"b\":{\"c\":[]}}", v));
+        BEAST_EXPECT(v["a"].size () == 7);
+        BEAST_EXPECT(v["a"][3u] == "s");
+        BEAST_EXPECT(v["a"][6u].asDouble () == -2.5);
+        BEAST_EXPECT(v["b"]["c"].isArray ());
+
+        Json::Reader r;
+        BEAST_EXPECT(! r.parse ("{\"a\":1,\"b\":2,\"a\":3}", v));
+        BEAST_EXPECT(r.getFormatedErrorMessages ().find (
+            "Key 'a' appears twice.") != std::string::npos);
+
+        for (auto const& doc : requestCorpus ())
+        {
+            Json::Value again;
+            BEAST_EXPECT(Json::Reader ().parse (doc, v));
+            BEAST_EXPECT(Json::Reader ().parse (to_string (v), again));
+            BEAST_EXPECT(v == again);
+        }
+    }
+
+public:
+    void
+    run () override
+    {
+        testStrings ();
+        testStructure ();
+    }
+};
+
+class Reader_timing_test : public beast::unit_test::suite
+{
+public:
+    void
+    run () override
+    {
+        using namespace std::chrono;
+
+        auto const corpus = requestCorpus ();
+        std::size_t bytes = 0;
+        for (auto const& doc : corpus)
+            bytes += doc.size ();
+
+        int const iterations = 20000;
+        auto const start = steady_clock::now ();
+        for (int i = 0; i < iterations; ++i)
+        {
+            for (auto const& doc : corpus)
+            {
+                Json::Value v;
+                Json::Reader ().parse (doc, v);
+            }
+        }
+        auto const elapsed = duration_cast<microseconds> (
+            steady_clock::now () - start);
+
+        log << "Parsed " << iterations * corpus.size () << " requests ("
+            << (bytes * iterations) / (1024 * 1024) << " MB) in "
+            << elapsed.count () / 1000 << " ms, "
+            << (bytes * iterations) / std::max<std::int64_t> (
+                elapsed.count (), 1) << " MB/s" << std::endl;
+        pass ();
+    }
+};
+
+BEAST_DEFINE_TESTSUITE(Reader, ripple_basics, ripple);
+BEAST_DEFINE_TESTSUITE_MANUAL(Reader_timing, ripple_basics, ripple);
+
+} // ripple
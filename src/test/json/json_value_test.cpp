@@ -225,6 +225,54 @@ struct json_value_test : beast::unit_test::suite
         testGreaterThan ("big");
     }
 
+    void test_append ()
+    {
+        Json::Value a;
+        a.append (1);
+        BEAST_EXPECT(a.isArray());
+
+        Json::Value const nested {"nested"};
+        a.append (nested);
+        BEAST_EXPECT(nested.asString() == "nested");
+
+        Json::Value moved {Json::objectValue};
+        moved["key"] = "value";
+        a.append (std::move (moved));
+        BEAST_EXPECT(a.size() == 3);
+        BEAST_EXPECT(a[1u] == nested);
+        BEAST_EXPECT(a[2u]["key"] == "value");
+
+        // A sparse array still appends after its highest index.
+        a[5u] = true;
+        a.append (false);
+        BEAST_EXPECT(a.size() == 7);
+        BEAST_EXPECT(a[3u].isNull());
+        BEAST_EXPECT(a[6u] == false);
+    }
+
+    void test_members ()
+    {
+        // Keys which are not static strings are copied into the object.
+        Json::Value o;
+        {
+            std::string key {"dynamic"};
+            o[key] = 1;
+            o[key.c_str()] = 2;
+            key = "changed";
+        }
+        static Json::StaticString const staticKey {"static"};
+        o[staticKey] = 3;
+        BEAST_EXPECT(o.size() == 2);
+        BEAST_EXPECT(o["dynamic"] == 2);
+        BEAST_EXPECT(o["static"] == 3);
+
+        Json::Value copy {o};
+        o.clear();
+        BEAST_EXPECT(copy["dynamic"] == 2);
+        BEAST_EXPECT(Json::FastWriter().write(copy) ==
+            "{\"dynamic\":2,\"static\":3}");
+    }
+
     void test_compact ()
     {
         Json::Value j;
@@ -351,6 +399,8 @@ struct json_value_test : beast::unit_test::suite
         test_copy ();
         test_move ();
         test_comparisons ();
+        test_append ();
+        test_members ();
         test_compact ();
         test_conversions();
         test_nest_limits ();
@@ -21,6 +21,10 @@
 #include <ripple/basics/random.h>
 #include <ripple/protocol/STAmount.h>
 #include <ripple/beast/unit_test.h>
+#include <ripple/beast/xor_shift_engine.h>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/optional.hpp>
+#include <limits>
 
 namespace ripple {
 
@@ -445,6 +449,332 @@ public:
 
     //--------------------------------------------------------------------------
 
+    // The arithmetic kernels as originally written, normalizing one power
+    // of ten at a time, kept as a reference for the optimized versions.
+    struct Reference
+    {
+        std::uint64_t value;
+        int offset;
+        bool negative;
+
+        static
+        Reference
+        canonical (bool native,
+            std::uint64_t value, int offset, bool negative)
+        {
+            if (native)
+            {
+                if (value == 0)
+                    return {0, 0, false};
+                while (offset < 0)
+                {
+                    value /= 10;
+                    ++offset;
+                }
+                while (offset > 0)
+                {
+                    value *= 10;
+                    --offset;
+                }
+                if (value > STAmount::cMaxNativeN)
+                    Throw<std::runtime_error> ("native overflow");
+                return {value, offset, negative};
+            }
+
+            if (value == 0)
+                return {0, -100, false};
+            while ((value < STAmount::cMinValue) &&
+                (offset > STAmount::cMinOffset))
+            {
+                value *= 10;
+                --offset;
+            }
+            while (value > STAmount::cMaxValue)
+            {
+                if (offset >= STAmount::cMaxOffset)
+                    Throw<std::runtime_error> ("value overflow");
+                value /= 10;
+                ++offset;
+            }
+            if ((offset < STAmount::cMinOffset) ||
+                (value < STAmount::cMinValue))
+                return {0, -100, false};
+            if (offset > STAmount::cMaxOffset)
+                Throw<std::runtime_error> ("value overflow");
+            return {value, offset, negative};
+        }
+
+        static
+        void
+        scale (STAmount const& a, std::uint64_t& value, int& offset)
+        {
+            value = a.mantissa ();
+            offset = a.exponent ();
+            if (a.native ())
+            {
+                while (value < STAmount::cMinValue)
+                {
+                    value *= 10;
+                    --offset;
+                }
+            }
+        }
+
+        static
+        std::uint64_t
+        muldiv (std::uint64_t a, std::uint64_t b,
+            std::uint64_t c, std::uint64_t rounding = 0)
+        {
+            boost::multiprecision::uint128_t ret;
+            boost::multiprecision::multiply (ret, a, b);
+            ret += rounding;
+            ret /= c;
+            if (ret > std::numeric_limits<std::uint64_t>::max ())
+                Throw<std::overflow_error> ("overflow");
+            return static_cast<std::uint64_t> (ret);
+        }
+
+        static
+        void
+        round (bool native, std::uint64_t& value, int& offset)
+        {
+            if (native)
+            {
+                if (offset < 0)
+                {
+                    int loops = 0;
+                    while (offset < -1)
+                    {
+                        value /= 10;
+                        ++offset;
+                        ++loops;
+                    }
+                    value += (loops >= 2) ? 9 : 10;
+                    value /= 10;
+                    ++offset;
+                }
+            }
+            else if (value > STAmount::cMaxValue)
+            {
+                while (value > (10 * STAmount::cMaxValue))
+                {
+                    value /= 10;
+                    ++offset;
+                }
+                value += 9;
+                value /= 10;
+                ++offset;
+            }
+        }
+
+        static
+        Reference
+        multiply (STAmount const& v1, STAmount const& v2, Issue const& issue)
+        {
+            if (v1 == beast::zero || v2 == beast::zero)
+                return canonical (isXRP (issue), 0, 0, false);
+            std::uint64_t value1, value2;
+            int offset1, offset2;
+            scale (v1, value1, offset1);
+            scale (v2, value2, offset2);
+            return canonical (isXRP (issue),
+                muldiv (value1, value2, 100000000000000ull) + 7,
+                offset1 + offset2 + 14, v1.negative () != v2.negative ());
+        }
+
+        static
+        Reference
+        divide (STAmount const& num, STAmount const& den, Issue const& issue)
+        {
+            if (num == beast::zero)
+                return canonical (isXRP (issue), 0, 0, false);
+            std::uint64_t numVal, denVal;
+            int numOffset, denOffset;
+            scale (num, numVal, numOffset);
+            scale (den, denVal, denOffset);
+            return canonical (isXRP (issue),
+                muldiv (numVal, 100000000000000000ull, denVal) + 5,
+                numOffset - denOffset - 17,
+                num.negative () != den.negative ());
+        }
+
+        static
+        Reference
+        finishRound (Issue const& issue, std::uint64_t amount,
+            int offset, bool resultNegative, bool roundUp)
+        {
+            bool const xrp = isXRP (issue);
+            if (resultNegative != roundUp)
+                round (xrp, amount, offset);
+            auto const result = canonical (
+                xrp, amount, offset, resultNegative);
+            if (roundUp && !resultNegative && result.value == 0)
+            {
+                if (xrp)
+                    return canonical (xrp, 1, 0, false);
+                return canonical (xrp, STAmount::cMinValue,
+                    STAmount::cMinOffset, false);
+            }
+            return result;
+        }
+
+        static
+        Reference
+        mulRound (STAmount const& v1, STAmount const& v2,
+            Issue const& issue, bool roundUp)
+        {
+            if (v1 == beast::zero || v2 == beast::zero)
+                return canonical (isXRP (issue), 0, 0, false);
+            std::uint64_t value1, value2;
+            int offset1, offset2;
+            scale (v1, value1, offset1);
+            scale (v2, value2, offset2);
+            bool const resultNegative = v1.negative () != v2.negative ();
+            std::uint64_t const tenTo14 = 100000000000000ull;
+            return finishRound (issue,
+                muldiv (value1, value2, tenTo14,
+                    (resultNegative != roundUp) ? tenTo14 - 1 : 0),
+                offset1 + offset2 + 14, resultNegative, roundUp);
+        }
+
+        static
+        Reference
+        divRound (STAmount const& num, STAmount const& den,
+            Issue const& issue, bool roundUp)
+        {
+            if (num == beast::zero)
+                return canonical (isXRP (issue), 0, 0, false);
+            std::uint64_t numVal, denVal;
+            int numOffset, denOffset;
+            scale (num, numVal, numOffset);
+            scale (den, denVal, denOffset);
+            bool const resultNegative =
+                num.negative () != den.negative ();
+            return finishRound (issue,
+                muldiv (numVal, 100000000000000000ull, denVal,
+                    (resultNegative != roundUp) ? denVal - 1 : 0),
+                numOffset - denOffset - 17, resultNegative, roundUp);
+        }
+    };
+
+    // Count the cases where an optimized kernel and the reference
+    // disagree on the result or on whether to throw.
+    template <class Kernel, class Expected>
+    static
+    bool
+    sameResult (Kernel&& kernel, Expected&& expected)
+    {
+        boost::optional<STAmount> actual;
+        boost::optional<Reference> wanted;
+        try
+        {
+            actual = kernel ();
+        }
+        catch (std::exception const&)
+        {
+        }
+        try
+        {
+            wanted = expected ();
+        }
+        catch (std::exception const&)
+        {
+        }
+        if (! actual || ! wanted)
+            return ! actual && ! wanted;
+        return actual->mantissa () == wanted->value &&
+            actual->exponent () == wanted->offset &&
+            actual->negative () == wanted->negative;
+    }
+
+    void testKernels ()
+    {
+        testcase ("arithmetic kernels");
+
+        beast::xor_shift_engine engine (314159);
+
+        auto randomMantissa = [&engine] ()
+        {
+            // Any number of digits, not just canonical mantissas
+            int const digits = rand_int (engine, 1, 20);
+            std::uint64_t value = rand_int (engine, std::uint64_t {1},
+                std::numeric_limits<std::uint64_t>::max ());
+            for (int i = 20; i > digits; --i)
+                value /= 10;
+            return std::max<std::uint64_t> (value, 1);
+        };
+
+        auto randomAmount = [&] (bool native)
+        {
+            if (native)
+            {
+                return STAmount (rand_int (engine, std::uint64_t {1},
+                    (rand_int (engine, 3) == 0) ? std::uint64_t {1000} :
+                        STAmount::cMaxNativeN), rand_bool (engine));
+            }
+            return STAmount (noIssue (),
+                rand_int (engine,
+                    STAmount::cMinValue, STAmount::cMaxValue),
+                rand_int (engine, STAmount::cMinOffset, STAmount::cMaxOffset),
+                rand_bool (engine));
+        };
+
+        int canonicalMismatches = 0;
+        for (int i = 0; i < 200000; ++i)
+        {
+            bool const native = rand_bool (engine);
+            std::uint64_t const value = randomMantissa ();
+            int const offset = native ?
+                rand_int (engine, -25, 3) :
+                rand_int (engine, -130, 110);
+            bool const negative = rand_bool (engine);
+            Issue const issue = native ? xrpIssue () : noIssue ();
+
+            if (! sameResult (
+                    [&]{ return STAmount (issue, value, offset, negative); },
+                    [&]{ return Reference::canonical (
+                        native, value, offset, negative); }))
+                ++canonicalMismatches;
+        }
+        BEAST_EXPECT(canonicalMismatches == 0);
+
+        int arithmeticMismatches = 0;
+        for (int i = 0; i < 200000; ++i)
+        {
+            bool const native1 = rand_int (engine, 3) == 0;
+            bool const native2 = rand_int (engine, 3) == 0;
+            STAmount const v1 = randomAmount (native1);
+            STAmount const v2 = randomAmount (native2);
+
+            // Native by native into XRP takes a separate exact path
+            Issue const issue = (! (native1 && native2) && rand_bool (engine))
+                ? xrpIssue () : noIssue ();
+            bool const roundUp = rand_bool (engine);
+
+            if (! sameResult (
+                    [&]{ return multiply (v1, v2, issue); },
+                    [&]{ return Reference::multiply (v1, v2, issue); }))
+                ++arithmeticMismatches;
+            if (! sameResult (
+                    [&]{ return divide (v1, v2, issue); },
+                    [&]{ return Reference::divide (v1, v2, issue); }))
+                ++arithmeticMismatches;
+            if (! sameResult (
+                    [&]{ return mulRound (v1, v2, issue, roundUp); },
+                    [&]{ return Reference::mulRound (
+                        v1, v2, issue, roundUp); }))
+                ++arithmeticMismatches;
+            if (! sameResult (
+                    [&]{ return divRound (v1, v2, issue, roundUp); },
+                    [&]{ return Reference::divRound (
+                        v1, v2, issue, roundUp); }))
+                ++arithmeticMismatches;
+        }
+        BEAST_EXPECT(arithmeticMismatches == 0);
+    }
+
+    //--------------------------------------------------------------------------
+
     void testUnderflow ()
     {
         testcase ("underflow");
@@ -612,6 +942,7 @@ public:
         testNativeCurrency ();
         testCustomCurrency ();
         testArithmetic ();
+        testKernels ();
         testUnderflow ();
         testRounding ();
         testConvertXRP ();
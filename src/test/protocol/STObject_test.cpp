@@ -18,6 +18,7 @@
 //==============================================================================
 
 #include <ripple/basics/Log.h>
+#include <ripple/protocol/Indexes.h>
 #include <ripple/protocol/jss.h>
 #include <ripple/protocol/SecretKey.h>
 #include <ripple/protocol/st.h>
@@ -257,6 +258,26 @@ public:
             testInvalid (STI_VECTOR256, 255);
             testInvalid (STI_OBJECT, 255);
         }
+        {
+            // Codes resolve to the registered field, whether or not
+            // they can appear in a serialized object.
+            auto testKnown = [this] (SField const& f)
+            {
+                BEAST_EXPECT (SField::getField (f.getCode ()) == f);
+                BEAST_EXPECT (&SField::getField (
+                    f.fieldType, f.fieldValue) == &f);
+            };
+            testKnown (sfFlags);
+            testKnown (sfBalance);
+            testKnown (sfTickSize);
+            testKnown (sfPaths);
+            testKnown (sfLedgerEntry);
+            testKnown (sfMetadata);
+            BEAST_EXPECT (&SField::getField (0) == &sfGeneric);
+            BEAST_EXPECT (SField::getField (-1) == sfInvalid);
+            BEAST_EXPECT (SField::getField (
+                field_code (STI_UINT32, 300)) == sfInvalid);
+        }
         {
             // Try to put sfInvalid in an SOTemplate.
             except<std::runtime_error>( [&]()
@@ -671,6 +692,65 @@ public:
         }
     }
 
+    void
+    testLedgerEntry()
+    {
+        testcase ("ledger entry");
+
+        AccountID const id {1};
+        auto const key = keylet::account(id);
+        STLedgerEntry sle (key);
+        sle.setAccountID (sfAccount, id);
+        sle.setFieldU32 (sfSequence, 17);
+        sle.setFieldAmount (sfBalance, STAmount (123456789));
+        sle.setFieldU32 (sfOwnerCount, 3);
+        sle.setFieldH256 (sfPreviousTxnID, uint256 (5));
+        sle.setFieldU32 (sfPreviousTxnLgrSeq, 99);
+        sle.setFieldVL (sfDomain, Blob (12, 'x'));
+
+        Serializer s;
+        sle.add (s);
+        {
+            SerialIter sit (s.slice());
+            STLedgerEntry const copy (sit, key.key);
+            BEAST_EXPECT(copy.getType() == ltACCOUNT_ROOT);
+            BEAST_EXPECT(copy.getFieldU32 (sfSequence) == 17);
+            BEAST_EXPECT(copy.getSerializer() == s);
+            BEAST_EXPECT(copy.isEquivalent (sle));
+        }
+
+        // Fields out of canonical order are still accepted
+        std::vector<STBase const*> fields;
+        for (auto const& f : sle)
+            if (f.getSType() != STI_NOTPRESENT)
+                fields.push_back (&f);
+        Serializer reversed;
+        for (auto it = fields.rbegin(); it != fields.rend(); ++it)
+        {
+            (*it)->addFieldID (reversed);
+            (*it)->add (reversed);
+        }
+        {
+            SerialIter sit (reversed.slice());
+            STLedgerEntry const copy (sit, key.key);
+            BEAST_EXPECT(copy.getSerializer() == s);
+        }
+
+        // But a field repeated out of order is not
+        sle.getField (sfSequence).addFieldID (reversed);
+        sle.getField (sfSequence).add (reversed);
+        try
+        {
+            SerialIter sit (reversed.slice());
+            STLedgerEntry const copy (sit, key.key);
+            fail ("duplicate field accepted");
+        }
+        catch (std::exception const& e)
+        {
+            BEAST_EXPECT(strcmp(e.what(), "Duplicate field detected") == 0);
+        }
+    }
+
     void
     testMalformed()
     {
@@ -713,6 +793,7 @@ public:
         testParseJSONArray();
         testParseJSONArrayWithInvalidChildrenObjects();
         testParseJSONEdgeCases();
+        testLedgerEntry();
         testMalformed();
     }
 };
@@ -24,6 +24,8 @@
 
 #include <boost/container/flat_set.hpp>
 
+#include <set>
+
 namespace ripple {
 
 namespace test {
@@ -548,6 +550,116 @@ class AccountTx_test : public beast::unit_test::suite
         }
     }
 
+    void
+    testPaging()
+    {
+        testcase("Paging");
+        using namespace test::jtx;
+
+        Env env(*this);
+        Account const A1 {"A1"};
+        Account const A2 {"A2"};
+        env.fund(XRP(10000), A1, A2);
+        env.close();
+
+        // Ledger 3 has A1's two funding txs, ledger 4 five payments to A1
+        // and ledgers 5 and 6 one payment each.
+        for (int i = 0; i < 5; ++i)
+            env(pay(A2, A1, XRP(1)));
+        env.close();
+        env(pay(A2, A1, XRP(1)));
+        env.close();
+        env(pay(A2, A1, XRP(1)));
+        env.close();
+
+        auto accountTx = [&](int min, int max, bool forward, int limit,
+            Json::Value const& marker = Json::nullValue)
+        {
+            Json::Value params;
+            params[jss::account] = A1.human();
+            params[jss::ledger_index_min] = min;
+            params[jss::ledger_index_max] = max;
+            params[jss::forward] = forward;
+            if (limit)
+                params[jss::limit] = limit;
+            if (marker)
+                params[jss::marker] = marker;
+            return env.rpc("json", "account_tx",
+                to_string(params))[jss::result];
+        };
+
+        auto hashes = [](Json::Value const& result)
+        {
+            std::vector<std::string> ret;
+            for (auto const& tx : result[jss::transactions])
+                ret.push_back(tx[jss::tx][jss::hash].asString());
+            return ret;
+        };
+
+        auto const all = hashes(accountTx(3, 6, true, 0));
+        if (! BEAST_EXPECT(all.size() == 9))
+            return;
+        BEAST_EXPECT(std::set<std::string>(all.begin(), all.end()).size() ==
+            all.size());
+
+        // Pages of two must split ledger 4 without losing or repeating
+        // any of its transactions, in either direction.
+        for (bool const forward : {true, false})
+        {
+            std::vector<std::string> paged;
+            Json::Value marker;
+            int pages = 0;
+            do
+            {
+                auto const result = accountTx(3, 6, forward, 2, marker);
+                auto const page = hashes(result);
+                BEAST_EXPECT(page.size() <= 2);
+                paged.insert(paged.end(), page.begin(), page.end());
+                marker = result[jss::marker];
+            } while (marker && ++pages < 10);
+
+            BEAST_EXPECT(! marker);
+            if (forward)
+                BEAST_EXPECT(paged == all);
+            else
+                BEAST_EXPECT(paged == std::vector<std::string>(
+                    all.rbegin(), all.rend()));
+        }
+
+        // A marker from outside the requested range either resumes from
+        // the start of the range or ends the listing.
+        {
+            auto const first = accountTx(3, 6, true, 2);
+            auto const marker = first[jss::marker];
+            if (! BEAST_EXPECT(marker && marker[jss::ledger] == 4))
+                return;
+
+            auto const before = accountTx(5, 6, true, 2, marker);
+            BEAST_EXPECT(hashes(before) ==
+                std::vector<std::string>(all.begin() + 7, all.end()));
+            BEAST_EXPECT(! before.isMember(jss::marker));
+
+            auto const past = accountTx(3, 3, true, 2, marker);
+            BEAST_EXPECT(hashes(past).empty());
+            BEAST_EXPECT(! past.isMember(jss::marker));
+        }
+        {
+            auto const first = accountTx(3, 6, false, 2);
+            auto const marker = first[jss::marker];
+            if (! BEAST_EXPECT(marker && marker[jss::ledger] == 4))
+                return;
+
+            auto const before = accountTx(3, 3, false, 2, marker);
+            BEAST_EXPECT(hashes(before) ==
+                std::vector<std::string>(all.rend() - 2, all.rend()));
+            BEAST_EXPECT(! before.isMember(jss::marker));
+
+            auto const past = accountTx(5, 6, false, 2, marker);
+            BEAST_EXPECT(hashes(past).empty());
+            BEAST_EXPECT(! past.isMember(jss::marker));
+        }
+    }
+
 public:
     void
     run() override
@@ -555,6 +667,7 @@ public:
         testParameters();
         testContents();
         testAccountDelete();
+        testPaging();
     }
 };
 BEAST_DEFINE_TESTSUITE(AccountTx, app, ripple);
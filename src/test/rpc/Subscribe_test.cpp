@@ -19,7 +19,10 @@
 #include <ripple/app/misc/LoadFeeTrack.h>
 #include <ripple/app/misc/NetworkOPs.h>
 #include <ripple/core/ConfigSections.h>
+#include <ripple/json/json_reader.h>
+#include <ripple/protocol/digest.h>
 #include <ripple/protocol/jss.h>
+#include <ripple/rpc/impl/WSInfoSub.h>
 #include <test/jtx/WSClient.h>
 #include <test/jtx/envconfig.h>
 #include <test/jtx.h>
@@ -663,6 +666,142 @@ public:
 
     }
 
+    // Records the messages sent to it, as a websocket session queues them
+    class RecordingSession : public WSSession
+    {
+        Port port_;
+        http_request_type request_;
+        boost::asio::ip::tcp::endpoint remote_;
+
+    public:
+        std::vector<std::shared_ptr<WSMsg>> sent;
+
+        void run() override {}
+
+        Port const& port() const override
+        {
+            return port_;
+        }
+
+        http_request_type const& request() const override
+        {
+            return request_;
+        }
+
+        boost::asio::ip::tcp::endpoint const& remote_endpoint() const override
+        {
+            return remote_;
+        }
+
+        void send(std::shared_ptr<WSMsg> w) override
+        {
+            sent.push_back(std::move(w));
+        }
+
+        void close() override {}
+
+        void close(boost::beast::websocket::close_reason const&) override {}
+
+        void complete() override {}
+    };
+
+    // Take the next chunk of a message the way a session writes it,
+    // returning whether it was the last one
+    static bool
+    writeChunk(WSMsg& m, std::size_t bytes, std::string& out,
+        char const** first = nullptr)
+    {
+        auto const result = m.prepare(bytes, []{});
+        for (auto const& b : result.second)
+        {
+            auto const data = static_cast<char const*>(b.data());
+            if (first && !*first)
+                *first = data;
+            out.append(data, b.size());
+        }
+        return static_cast<bool>(result.first);
+    }
+
+    // Write the rest of a message, returning the number of chunks
+    static std::size_t
+    writeAll(WSMsg& m, std::size_t bytes, std::string& out,
+        char const** first = nullptr)
+    {
+        std::size_t chunks = 1;
+        while (!writeChunk(m, bytes, out, first))
+            ++chunks;
+        return chunks;
+    }
+
+    void testSharedEvent()
+    {
+        testcase("Shared event");
+
+        using namespace jtx;
+        Env env(*this);
+
+        Json::Value jv;
+        jv[jss::type] = "ledgerClosed";
+        jv[jss::ledger_index] = 7;
+        jv[jss::ledger_hash] = to_string(sha512Half(std::string("ledger")));
+        jv[jss::txn_count] = 3;
+        auto event = std::make_shared<InfoSub::Event const>(jv);
+
+        std::vector<std::shared_ptr<RecordingSession>> sessions;
+        std::vector<InfoSub::pointer> subs;
+        for (int i = 0; i < 3; ++i)
+        {
+            sessions.push_back(std::make_shared<RecordingSession>());
+            subs.push_back(std::make_shared<WSInfoSub>(
+                env.app().getOPs(), sessions.back()));
+            subs.back()->send(event, true);
+            BEAST_EXPECT(sessions.back()->sent.size() == 1);
+        }
+
+        // Every session queues the same serialization
+        auto const text = event->text();
+        {
+            Json::Value parsed;
+            BEAST_EXPECT(Json::Reader().parse(*text, parsed));
+            BEAST_EXPECT(parsed == jv);
+        }
+
+        // The third session closes after writing part of the event. Its
+        // pending write still holds the message.
+        auto pending = sessions[2]->sent.front();
+        std::string partial;
+        BEAST_EXPECT(!writeChunk(*pending, 5, partial));
+        sessions[2].reset();
+        subs[2]->send(event, true);
+
+        // The publisher lets go of the event too
+        std::weak_ptr<std::string const> weakText = text;
+        event.reset();
+        BEAST_EXPECT(!weakText.expired());
+
+        // The other sessions write identical bytes out of one buffer,
+        // whatever the size of their writes
+        std::string out0, out1;
+        char const* first0 = nullptr;
+        char const* first1 = nullptr;
+        BEAST_EXPECT(writeAll(*sessions[0]->sent.front(), 4, out0, &first0)
+            == (text->size() + 3) / 4);
+        BEAST_EXPECT(writeAll(*sessions[1]->sent.front(), 4096, out1, &first1)
+            == 1);
+        BEAST_EXPECT(out0 == *text);
+        BEAST_EXPECT(out1 == *text);
+        BEAST_EXPECT(first0 == text->data());
+        BEAST_EXPECT(first1 == text->data());
+
+        // The closed session's write completes from the same buffer
+        writeAll(*pending, 5, partial);
+        BEAST_EXPECT(partial == *text);
+
+        sessions.clear();
+        subs.clear();
+        pending.reset();
+        BEAST_EXPECT(weakText.use_count() == 1);
+    }
 
     void run() override
     {
@@ -674,6 +813,7 @@ public:
         testSubErrors(true);
         testSubErrors(false);
         testSubByUrl();
+        testSharedEvent();
     }
 };
 
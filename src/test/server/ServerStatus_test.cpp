@@ -998,6 +998,79 @@ class ServerStatus_test :
         }
     }
 
+    void
+    testStreamedRequest(boost::asio::yield_context& yield)
+    {
+        testcase ("RPC client receives a streamed reply");
+
+        using namespace test::jtx;
+        Env env {*this};
+
+        Account const alice {"alice"};
+        Account const bob {"bob"};
+        env.fund(XRP(10000), alice, bob);
+        env.close();
+        for (int i = 0; i < 5; ++i)
+            env(pay(alice, bob, XRP(10 + i)));
+        env.close();
+
+        auto const closed = env.closed();
+        Json::Value jv;
+        jv[jss::method] = "ledger";
+        jv[jss::params] = Json::arrayValue;
+        jv[jss::params][0u][jss::ledger_index] = closed->info().seq;
+        jv[jss::params][0u][jss::transactions] = true;
+        jv[jss::params][0u][jss::expand] = true;
+        jv[jss::params][0u][jss::id] = 7;
+
+        {
+            boost::system::error_code ec;
+            boost::beast::http::response<boost::beast::http::string_body> resp;
+            doHTTPRequest(env, yield, false, resp, ec, to_string(jv));
+            BEAST_EXPECT(! ec);
+            BEAST_EXPECT(resp.result() == boost::beast::http::status::ok);
+            BEAST_EXPECT(resp.chunked());
+            BEAST_EXPECT(resp.find(
+                boost::beast::http::field::content_length) == resp.end());
+            BEAST_EXPECT(boost::ends_with(resp.body(), "\n"));
+
+            Json::Value reply;
+            BEAST_EXPECT(Json::Reader{}.parse(resp.body(), reply));
+            auto const& result = reply[jss::result];
+            BEAST_EXPECT(result[jss::status] == jss::success);
+            BEAST_EXPECT(reply[jss::id] == 7);
+            auto const& ledger = result[jss::ledger];
+            BEAST_EXPECT(ledger[jss::ledger_hash] ==
+                to_string(closed->info().hash));
+            BEAST_EXPECT(ledger[jss::ledger_index] ==
+                std::to_string(closed->info().seq));
+            BEAST_EXPECT(ledger[jss::transactions].isArray());
+            BEAST_EXPECT(ledger[jss::transactions].size() == 5);
+            for (auto const& tx : ledger[jss::transactions])
+                BEAST_EXPECT(tx[jss::TransactionType] == jss::Payment);
+        }
+
+        // An error is streamed too, with the request masked
+        jv[jss::params][0u][jss::ledger_index] = closed->info().seq + 100;
+        jv[jss::params][0u][jss::secret] = "not a real secret";
+        {
+            boost::system::error_code ec;
+            boost::beast::http::response<boost::beast::http::string_body> resp;
+            doHTTPRequest(env, yield, false, resp, ec, to_string(jv));
+            BEAST_EXPECT(! ec);
+            BEAST_EXPECT(resp.result() == boost::beast::http::status::ok);
+            BEAST_EXPECT(resp.chunked());
+
+            Json::Value reply;
+            BEAST_EXPECT(Json::Reader{}.parse(resp.body(), reply));
+            auto const& result = reply[jss::result];
+            BEAST_EXPECT(result[jss::status] == jss::error);
+            BEAST_EXPECT(result[jss::error] == "lgrNotFound");
+            BEAST_EXPECT(result[jss::request][jss::secret] == "<masked>");
+            BEAST_EXPECT(result[jss::request][jss::command] == "ledger");
+        }
+    }
+
     void
     testStatusNotOkay(boost::asio::yield_context& yield)
     {
@@ -1055,6 +1128,7 @@ public:
             testNoRPC (yield);
             testWSRequests (yield);
             testRPCRequests (yield);
+            testStreamedRequest (yield);
             testStatusNotOkay (yield);
         });
 
@@ -0,0 +1,139 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2019 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <ripple/basics/chrono.h>
+#include <ripple/protocol/digest.h>
+#include <ripple/shamap/FullBelowCache.h>
+#include <ripple/beast/unit_test.h>
+#include <ripple/beast/utility/temp_dir.h>
+#include <test/unit_test/SuiteJournal.h>
+#include <fstream>
+
+namespace ripple {
+namespace tests {
+
+class FullBelowCache_test : public beast::unit_test::suite
+{
+    static std::vector<uint256>
+    makeKeys (std::size_t n)
+    {
+        std::vector<uint256> keys;
+        for (std::size_t i = 1; i <= n; ++i)
+            keys.push_back (sha512Half (i));
+        return keys;
+    }
+
+    void
+    testRoundTrip ()
+    {
+        testcase ("save and load");
+
+        test::SuiteJournal journal ("FullBelowCache_test", *this);
+        TestStopwatch clock;
+        beast::temp_dir dir;
+        boost::filesystem::path const file {dir.file ("fullbelow.bin")};
+        auto const keys = makeKeys (100);
+        auto const stored = [](uint256 const&) { return true; };
+
+        {
+            FullBelowCache saved ("saved", clock);
+            for (auto const& key : keys)
+                saved.insert (key);
+            BEAST_EXPECT(saved.save (file, "rippledb.1"));
+        }
+
+        FullBelowCache loaded ("loaded", clock);
+        BEAST_EXPECT(loaded.load (file, "rippledb.1", stored, journal) ==
+            keys.size());
+        BEAST_EXPECT(loaded.size () == keys.size());
+        for (auto const& key : keys)
+            BEAST_EXPECT(loaded.touch_if_exists (key));
+
+        // The file is consumed by loading it
+        BEAST_EXPECT(! boost::filesystem::exists (file));
+        BEAST_EXPECT(loaded.load (file, "rippledb.1", stored, journal) == 0);
+
+        // An empty cache round trips too
+        FullBelowCache empty ("empty", clock);
+        BEAST_EXPECT(empty.save (file, "rippledb.1"));
+        BEAST_EXPECT(empty.load (file, "rippledb.1", stored, journal) == 0);
+        BEAST_EXPECT(empty.size () == 0);
+    }
+
+    void
+    testInvalidation ()
+    {
+        testcase ("invalidation");
+
+        test::SuiteJournal journal ("FullBelowCache_test", *this);
+        TestStopwatch clock;
+        beast::temp_dir dir;
+        boost::filesystem::path const file {dir.file ("fullbelow.bin")};
+        auto const keys = makeKeys (100);
+
+        FullBelowCache saved ("saved", clock);
+        for (auto const& key : keys)
+            saved.insert (key);
+
+        // Online delete rotated to another backend since the save
+        {
+            BEAST_EXPECT(saved.save (file, "rippledb.1"));
+            FullBelowCache loaded ("loaded", clock);
+            BEAST_EXPECT(loaded.load (file, "rippledb.2",
+                [](uint256 const&) { return true; }, journal) == 0);
+            BEAST_EXPECT(loaded.size () == 0);
+            BEAST_EXPECT(! boost::filesystem::exists (file));
+        }
+
+        // Same backend name, but the node store was replaced
+        {
+            BEAST_EXPECT(saved.save (file, "rippledb.1"));
+            FullBelowCache loaded ("loaded", clock);
+            BEAST_EXPECT(loaded.load (file, "rippledb.1",
+                [](uint256 const&) { return false; }, journal) == 0);
+            BEAST_EXPECT(loaded.size () == 0);
+        }
+
+        // A truncated file is not mistaken for one from this backend
+        {
+            {
+                std::ofstream ofs (file.string (), std::ios::binary);
+                ofs << "rip";
+            }
+            FullBelowCache loaded ("loaded", clock);
+            BEAST_EXPECT(loaded.load (file, "rippledb.1",
+                [](uint256 const&) { return true; }, journal) == 0);
+            BEAST_EXPECT(loaded.size () == 0);
+            BEAST_EXPECT(! boost::filesystem::exists (file));
+        }
+    }
+
+public:
+    void
+    run () override
+    {
+        testRoundTrip ();
+        testInvalidation ();
+    }
+};
+
+BEAST_DEFINE_TESTSUITE(FullBelowCache,shamap,ripple);
+
+} // tests
+} // ripple
@@ -19,8 +19,10 @@
 //==============================================================================
 
 #include <test/app/AccountDelete_test.cpp>
+#include <test/app/AccountSubscriptions_test.cpp>
 #include <test/app/AccountTxPaging_test.cpp>
 #include <test/app/AmendmentTable_test.cpp>
+#include <test/app/CanonicalTXSet_test.cpp>
 #include <test/app/Check_test.cpp>
 #include <test/app/CrossingLimits_test.cpp>
 #include <test/app/DeliverMin_test.cpp>
@@ -31,6 +31,7 @@
 #include <test/app/SHAMapStore_test.cpp>
 #include <test/app/Taker_test.cpp>
 #include <test/app/Ticket_test.cpp>
+#include <test/app/TransactionMaster_test.cpp>
 #include <test/app/Transaction_ordering_test.cpp>
 #include <test/app/TrustAndBalance_test.cpp>
 #include <test/app/TxQ_test.cpp>
@@ -19,6 +19,7 @@
 //==============================================================================
 
 #include <test/json/json_value_test.cpp>
+#include <test/json/Reader_test.cpp>
 #include <test/json/Object_test.cpp>
 #include <test/json/Output_test.cpp>
 #include <test/json/Writer_test.cpp>
\ No newline at end of file
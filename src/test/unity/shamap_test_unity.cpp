@@ -19,5 +19,6 @@
 //==============================================================================
 
 #include <test/shamap/FetchPack_test.cpp>
+#include <test/shamap/FullBelowCache_test.cpp>
 #include <test/shamap/SHAMapSync_test.cpp>
 #include <test/shamap/SHAMap_test.cpp>
\ No newline at end of file